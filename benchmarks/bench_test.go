@@ -0,0 +1,183 @@
+// Package benchmarks measures the hot paths across the Go/WASM boundary so
+// performance claims are backed by numbers and regressions are caught in
+// review instead of production.
+//
+// Workflow:
+//
+//	go test -bench . -benchmem -count 10 ./benchmarks | tee new.txt
+//	benchstat reference.txt new.txt
+//
+// reference.txt holds the checked-in baseline from the CI reference
+// machine; CI compares against it and flags deltas above 5%. Refresh the
+// baseline (on that machine) whenever a deliberate performance change
+// lands.
+package benchmarks
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/Gaurav-Gosain/quickjs"
+)
+
+// newBenchContext returns a warm runtime and context shared by all
+// iterations of a benchmark, so timings measure the operation under test
+// rather than instantiation.
+func newBenchContext(b *testing.B) (*quickjs.Runtime, *quickjs.Context) {
+	b.Helper()
+	rt, err := quickjs.NewRuntime()
+	if err != nil {
+		b.Fatalf("NewRuntime() error = %v", err)
+	}
+	ctx, err := rt.NewContext()
+	if err != nil {
+		rt.Close()
+		b.Fatalf("NewContext() error = %v", err)
+	}
+	b.Cleanup(func() {
+		ctx.Close()
+		rt.Close()
+	})
+	return rt, ctx
+}
+
+const benchScript = `(() => {
+	let sum = 0;
+	for (let i = 0; i < 100; i++) sum += i * i;
+	return sum;
+})()`
+
+// BenchmarkEvalParse parses and executes the script on every iteration —
+// the cost a naive caller pays per request.
+func BenchmarkEvalParse(b *testing.B) {
+	_, ctx := newBenchContext(b)
+	for b.Loop() {
+		if _, err := ctx.Eval(benchScript); err != nil {
+			b.Fatalf("Eval error = %v", err)
+		}
+	}
+}
+
+// BenchmarkEvalCachedScript executes precompiled bytecode, skipping the
+// parser — the intended hot path for repeated scripts.
+func BenchmarkEvalCachedScript(b *testing.B) {
+	_, ctx := newBenchContext(b)
+	bytecode, err := ctx.Compile(benchScript)
+	if err != nil {
+		b.Fatalf("Compile error = %v", err)
+	}
+	b.ResetTimer()
+	for b.Loop() {
+		if _, err := ctx.EvalBytecode(bytecode); err != nil {
+			b.Fatalf("EvalBytecode error = %v", err)
+		}
+	}
+}
+
+func BenchmarkValueGet(b *testing.B) {
+	_, ctx := newBenchContext(b)
+	obj, err := ctx.Eval(`({id: 1, timestamp: 2, payload: "x"})`)
+	if err != nil {
+		b.Fatalf("Eval error = %v", err)
+	}
+	b.ResetTimer()
+	for b.Loop() {
+		if _, err := obj.Get("payload"); err != nil {
+			b.Fatalf("Get error = %v", err)
+		}
+	}
+}
+
+func BenchmarkValueSet(b *testing.B) {
+	_, ctx := newBenchContext(b)
+	obj, err := ctx.Eval("({})")
+	if err != nil {
+		b.Fatalf("Eval error = %v", err)
+	}
+	val := ctx.Int32(42)
+	b.ResetTimer()
+	for b.Loop() {
+		if err := obj.Set("payload", val); err != nil {
+			b.Fatalf("Set error = %v", err)
+		}
+	}
+}
+
+// BenchmarkCallbackRoundTrip measures a JS->Go->JS round trip through
+// hostCallGo: a compiled script invoking a bound Go function.
+func BenchmarkCallbackRoundTrip(b *testing.B) {
+	_, ctx := newBenchContext(b)
+	fn := ctx.Function("add", func(c *quickjs.Context, this quickjs.Value, args []quickjs.Value) quickjs.Value {
+		a, _ := args[0].Int32()
+		x, _ := args[1].Int32()
+		return c.Int32(a + x)
+	})
+	if err := ctx.SetGlobal("add", fn); err != nil {
+		b.Fatalf("SetGlobal error = %v", err)
+	}
+	bytecode, err := ctx.Compile("add(1, 2)")
+	if err != nil {
+		b.Fatalf("Compile error = %v", err)
+	}
+	b.ResetTimer()
+	for b.Loop() {
+		if _, err := ctx.EvalBytecode(bytecode); err != nil {
+			b.Fatalf("EvalBytecode error = %v", err)
+		}
+	}
+}
+
+// BenchmarkArrayBufferTransfer measures moving buffers into the engine and
+// copying them back out at the sizes our workloads ship.
+func BenchmarkArrayBufferTransfer(b *testing.B) {
+	sizes := []int{1 << 10, 1 << 20, 16 << 20}
+	names := []string{"1KB", "1MB", "16MB"}
+	for i, size := range sizes {
+		b.Run(names[i], func(b *testing.B) {
+			_, ctx := newBenchContext(b)
+			data := make([]byte, size)
+			for j := range data {
+				data[j] = byte(j)
+			}
+			b.SetBytes(int64(size))
+			b.ResetTimer()
+			for b.Loop() {
+				buf := ctx.ArrayBuffer(data)
+				if _, err := buf.Bytes(); err != nil {
+					b.Fatalf("Bytes error = %v", err)
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkJSONRoundTrip measures the byte-oriented JSON fast path on a
+// representative document.
+func BenchmarkJSONRoundTrip(b *testing.B) {
+	_, ctx := newBenchContext(b)
+	doc := []byte(fmt.Sprintf(`{"id":7,"items":%s}`, benchJSONItems(100)))
+	dst := make([]byte, 0, len(doc))
+	b.SetBytes(int64(len(doc)))
+	b.ResetTimer()
+	for b.Loop() {
+		val, err := ctx.ParseJSONBytes(doc)
+		if err != nil {
+			b.Fatalf("ParseJSONBytes error = %v", err)
+		}
+		dst, err = val.AppendJSON(dst[:0])
+		if err != nil {
+			b.Fatalf("AppendJSON error = %v", err)
+		}
+	}
+}
+
+func benchJSONItems(n int) string {
+	out := "["
+	for i := 0; i < n; i++ {
+		if i > 0 {
+			out += ","
+		}
+		out += fmt.Sprintf(`{"k":%d,"v":"item-%d"}`, i, i)
+	}
+	return out + "]"
+}
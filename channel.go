@@ -0,0 +1,176 @@
+package quickjs
+
+import (
+	"encoding/binary"
+	"errors"
+	"reflect"
+)
+
+// Channel streams small events from Go into a JavaScript callback at
+// memcpy rate instead of call rate. Push writes marshal-encoded records
+// into a ring buffer in WASM linear memory without touching the runtime
+// mutex; Drain takes the lock once, decodes every buffered record inside
+// the engine and delivers them to the callback as a single batch array.
+// Compared to one Value.Call per event, steady-state delivery costs two
+// crossings per batch regardless of how many events it carries.
+//
+// The ring is single-producer/single-consumer: Push may be called from one
+// goroutine at a time, concurrently with other work on the runtime, and
+// Drain follows the usual runtime serialization. One channel can be open
+// per Runtime.
+type Channel struct {
+	ctx     *Context
+	bufPtr  uint32
+	cap     uint32
+	headPtr uint32
+	tailPtr uint32
+	tail    uint32 // producer index; the authoritative copy is in WASM memory
+}
+
+// ErrChannelFull is returned by Push when the ring has no room for the
+// event; Drain to make space.
+var ErrChannelFull = errors.New("channel ring buffer is full")
+
+// channelWrapMarker tells the consumer the producer continued at offset 0
+// because the record did not fit before the end of the ring. Matches
+// CHANNEL_WRAP in csrc/bridge.c.
+const channelWrapMarker = 0xFFFFFFFF
+
+// NewChannel opens the runtime's event channel. fn must be a JavaScript
+// function; each Drain invokes it once with an array of the buffered
+// events (decoded per Marshal's rules).
+func (c *Context) NewChannel(fn Value) (*Channel, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	ok, err := c.runtime.bridge.ChannelInit(c.runtime.goCtx, c.ctxPtr, fn.ptr)
+	if err != nil {
+		return nil, err
+	}
+	if !ok {
+		return nil, errors.New("channel already open or callback is not a function")
+	}
+	layout, err := c.runtime.bridge.ChannelLayout(c.runtime.goCtx)
+	if err != nil {
+		c.runtime.bridge.ChannelClose(c.runtime.goCtx)
+		return nil, err
+	}
+
+	return &Channel{
+		ctx:     c,
+		bufPtr:  layout.BufPtr,
+		cap:     layout.Cap,
+		headPtr: layout.HeadPtr,
+		tailPtr: layout.TailPtr,
+	}, nil
+}
+
+// Push encodes the event (following Marshal's rules) and appends it to the
+// ring buffer. It performs only direct linear-memory writes — no runtime
+// lock and no WASM call — so it can run while the engine is busy.
+func (ch *Channel) Push(v any) error {
+	payload, err := appendMarshal(nil, reflect.ValueOf(v))
+	if err != nil {
+		return err
+	}
+	return ch.pushPayload(payload)
+}
+
+// PushBinary is a convenience for pre-encoded events: data must be one
+// value in the marshal wire format. Useful when the same event is pushed
+// to many runtimes.
+func (ch *Channel) PushBinary(data []byte) error {
+	// Validate the frame so a malformed buffer fails here, not inside the
+	// engine during Drain.
+	if off, err := skipValue(data, 0); err != nil || off != len(data) {
+		return errors.New("data is not a single marshal-encoded value")
+	}
+	return ch.pushPayload(data)
+}
+
+// pushPayload appends one length-prefixed record to the ring.
+func (ch *Channel) pushPayload(payload []byte) error {
+	rec := uint32(4 + len(payload))
+	if rec >= ch.cap {
+		return errors.New("event larger than channel capacity")
+	}
+
+	mem := ch.ctx.runtime.bridge.Memory()
+	head, ok := mem.ReadUint32Le(ch.headPtr)
+	if !ok {
+		return errors.New("failed to read channel head")
+	}
+
+	// Free bytes between tail and head, keeping one byte unused so
+	// tail == head always means empty.
+	free := (head - ch.tail - 1 + ch.cap) % ch.cap
+
+	tail := ch.tail
+	if ch.cap-tail < 4 {
+		// Too little room even for a length prefix: the consumer wraps
+		// implicitly, and the dead bytes stay "used" until head passes them.
+		if ch.cap-tail > free {
+			return ErrChannelFull
+		}
+		free -= ch.cap - tail
+		tail = 0
+	} else if ch.cap-tail < rec {
+		// Record will not fit contiguously: spend 4 bytes on a wrap marker
+		// and the rest of the ring tail as dead space.
+		if ch.cap-tail > free {
+			return ErrChannelFull
+		}
+		if !mem.WriteUint32Le(ch.bufPtr+tail, channelWrapMarker) {
+			return errors.New("failed to write channel record")
+		}
+		free -= ch.cap - tail
+		tail = 0
+	}
+	if rec > free {
+		return ErrChannelFull
+	}
+
+	if !mem.WriteUint32Le(ch.bufPtr+tail, uint32(len(payload))) {
+		return errors.New("failed to write channel record")
+	}
+	if !mem.Write(ch.bufPtr+tail+4, payload) {
+		return errors.New("failed to write channel record")
+	}
+	tail = (tail + rec) % ch.cap
+
+	// Publish the new tail last so the consumer never sees a half-written
+	// record.
+	if !mem.WriteUint32Le(ch.tailPtr, tail) {
+		return errors.New("failed to publish channel tail")
+	}
+	ch.tail = tail
+	return nil
+}
+
+// Drain decodes every buffered event inside the engine and calls the
+// channel's JavaScript callback with the batch. Returns the number of
+// events delivered (0 if the ring was empty; the callback is not invoked
+// for empty batches).
+func (ch *Channel) Drain() (int, error) {
+	c := ch.ctx
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	n, err := c.runtime.bridge.ChannelPoll(c.runtime.goCtx)
+	if err != nil {
+		return 0, err
+	}
+	if n < 0 {
+		return 0, c.pendingError()
+	}
+	return int(n), nil
+}
+
+// Close releases the channel's JavaScript callback. The Channel must not
+// be used afterwards.
+func (ch *Channel) Close() error {
+	c := ch.ctx
+	c.runtime.lock()
+	defer c.runtime.unlock()
+	return c.runtime.bridge.ChannelClose(c.runtime.goCtx)
+}
@@ -113,6 +113,7 @@ func run() int {
 	showVersion := flag.Bool("version", false, "show version")
 	showHelp := flag.Bool("help", false, "show help")
 	timing := flag.Bool("timing", false, "show execution time")
+	runBench := flag.Bool("bench", false, "run JS microbenchmarks and exit")
 	flag.Parse()
 
 	initSyntaxHighlighter()
@@ -148,6 +149,11 @@ func run() int {
 		startTime:  time.Now(),
 	}
 
+	if *runBench {
+		state.cmdBenchmark()
+		return 0
+	}
+
 	if *evalCode != "" {
 		result, duration, err := state.eval(*evalCode)
 		if err != nil {
@@ -195,6 +201,7 @@ func printUsage() {
 
 	fmt.Println(logoStyle.Render("OPTIONS"))
 	fmt.Println("  " + cmdStyle.Render("-e <code>") + "      Evaluate JavaScript code and exit")
+	fmt.Println("  " + cmdStyle.Render("-bench") + "         Run JS microbenchmarks and exit")
 	fmt.Println("  " + cmdStyle.Render("-timing") + "        Show execution time")
 	fmt.Println("  " + cmdStyle.Render("-version") + "       Show version information")
 	fmt.Println("  " + cmdStyle.Render("-help") + "          Show this help message")
@@ -17,61 +17,117 @@
 #include <stdint.h>
 
 // ============================================================================
-// JSValue Slot Storage (with freelist for reuse)
+// JSValue Slot Storage (chunked, growable, with generation counters)
 // ============================================================================
 
-#define MAX_JSVALUE_SLOTS 65536  // 64K slots = 512KB for JSValues
+// Handles pack an 8-bit generation with a 24-bit slot index. The table grows
+// one chunk at a time (chunks are malloc'd on demand and never move, so
+// existing indices stay stable), giving headroom far past the old 64K cap.
+// The generation is bumped whenever a slot is freed, so a stale Go-side
+// handle whose slot was recycled is detected instead of silently aliasing
+// the new occupant.
+
+#define SLOT_CHUNK_BITS  16
+#define SLOT_CHUNK_SIZE  (1u << SLOT_CHUNK_BITS)  // 64K slots per chunk
+#define SLOT_MAX_CHUNKS  256                      // 16M slots total
+#define SLOT_INDEX_MASK  0x00FFFFFFu
+#define SLOT_GEN_SHIFT   24
 
 typedef struct {
     JSValue value;
     uint32_t next_free;  // Index of next free slot (0 = end of list)
+    uint8_t generation;  // Must match the handle's generation byte
+    uint8_t in_use;
 } JSValueSlot;
 
-static JSValueSlot jsvalue_slots[MAX_JSVALUE_SLOTS];
-static uint32_t first_free_slot = 0;  // Head of freelist
-static int slots_initialized = 0;
+static JSValueSlot* slot_chunks[SLOT_MAX_CHUNKS];
+static uint32_t slot_count = 0;       // Slots across all allocated chunks
+static uint32_t first_free_slot = 0;  // Head of freelist (index, not handle)
+static uint32_t stale_handle_uses = 0;
 
-static void init_jsvalue_slots(void) {
-    if (slots_initialized) return;
-    // Initialize freelist: each slot points to the next
-    for (uint32_t i = 0; i < MAX_JSVALUE_SLOTS - 1; i++) {
-        jsvalue_slots[i].next_free = i + 1;
-        jsvalue_slots[i].value = JS_UNDEFINED;
+static JSValueSlot* slot_at(uint32_t index) {
+    return &slot_chunks[index >> SLOT_CHUNK_BITS][index & (SLOT_CHUNK_SIZE - 1)];
+}
+
+// Allocates the next chunk and threads its slots onto the freelist.
+// Returns 0 if the table is at capacity or malloc fails.
+static int grow_slot_table(void) {
+    uint32_t chunk = slot_count >> SLOT_CHUNK_BITS;
+    if (chunk >= SLOT_MAX_CHUNKS) return 0;
+
+    JSValueSlot* slots = malloc(SLOT_CHUNK_SIZE * sizeof(JSValueSlot));
+    if (!slots) return 0;
+    slot_chunks[chunk] = slots;
+
+    uint32_t base = slot_count;
+    for (uint32_t i = 0; i < SLOT_CHUNK_SIZE; i++) {
+        slots[i].value = JS_UNDEFINED;
+        slots[i].next_free = base + i + 1;
+        slots[i].generation = 0;
+        slots[i].in_use = 0;
+    }
+    slots[SLOT_CHUNK_SIZE - 1].next_free = first_free_slot;
+    if (base == 0) {
+        // Index 0 is reserved (represents NULL) and never enters the list.
+        slots[0].next_free = 0;
+        first_free_slot = 1;
+    } else {
+        first_free_slot = base;
     }
-    jsvalue_slots[MAX_JSVALUE_SLOTS - 1].next_free = 0;  // End of list
-    first_free_slot = 1;  // Slot 0 is reserved (represents NULL)
-    slots_initialized = 1;
+    slot_count += SLOT_CHUNK_SIZE;
+    return 1;
 }
 
-// Store a JSValue and return slot index (1-based, 0 = NULL/error)
+static void init_jsvalue_slots(void) {
+    if (slot_count == 0) grow_slot_table();
+}
+
+// Store a JSValue and return its handle (0 = NULL/error)
 static uint32_t store_jsvalue(JSValue val) {
     init_jsvalue_slots();
-    
-    if (first_free_slot == 0) {
-        // No free slots
+
+    if (first_free_slot == 0 && !grow_slot_table()) {
+        // Table at capacity
         return 0;
     }
-    
-    uint32_t slot = first_free_slot;
-    first_free_slot = jsvalue_slots[slot].next_free;
-    jsvalue_slots[slot].value = val;
-    jsvalue_slots[slot].next_free = 0;  // Mark as in-use
-    
-    return slot;
-}
 
-// Load a JSValue from slot index
-static JSValue load_jsvalue(uint32_t slot) {
-    if (slot == 0 || slot >= MAX_JSVALUE_SLOTS) return JS_UNDEFINED;
-    return jsvalue_slots[slot].value;
+    uint32_t index = first_free_slot;
+    JSValueSlot* s = slot_at(index);
+    first_free_slot = s->next_free;
+    s->value = val;
+    s->next_free = 0;
+    s->in_use = 1;
+
+    return ((uint32_t)s->generation << SLOT_GEN_SHIFT) | index;
+}
+
+// Load a JSValue from a handle
+static JSValue load_jsvalue(uint32_t handle) {
+    uint32_t index = handle & SLOT_INDEX_MASK;
+    if (index == 0 || index >= slot_count) return JS_UNDEFINED;
+    JSValueSlot* s = slot_at(index);
+    if (!s->in_use || s->generation != (uint8_t)(handle >> SLOT_GEN_SHIFT)) {
+        // Use-after-free: the slot was recycled since this handle was issued
+        stale_handle_uses++;
+        return JS_UNDEFINED;
+    }
+    return s->value;
 }
 
 // Free a JSValue slot (return to freelist)
-static void free_jsvalue_slot(uint32_t slot) {
-    if (slot == 0 || slot >= MAX_JSVALUE_SLOTS) return;
-    jsvalue_slots[slot].value = JS_UNDEFINED;
-    jsvalue_slots[slot].next_free = first_free_slot;
-    first_free_slot = slot;
+static void free_jsvalue_slot(uint32_t handle) {
+    uint32_t index = handle & SLOT_INDEX_MASK;
+    if (index == 0 || index >= slot_count) return;
+    JSValueSlot* s = slot_at(index);
+    if (!s->in_use || s->generation != (uint8_t)(handle >> SLOT_GEN_SHIFT)) {
+        stale_handle_uses++;
+        return;
+    }
+    s->value = JS_UNDEFINED;
+    s->in_use = 0;
+    s->generation++;  // Invalidate outstanding handles to this slot
+    s->next_free = first_free_slot;
+    first_free_slot = index;
 }
 
 // ============================================================================
@@ -85,6 +141,10 @@ static size_t arena_ptr = 0;
 // Allocate from arena (for temporary data from Go)
 static void* arena_alloc(size_t size) {
     size = (size + 7) & ~7;  // 8-byte alignment
+    // Requests larger than the arena must fail loudly: wrapping would hand
+    // out memory overlapping in-flight allocations. Oversized payloads go
+    // through the streaming eval API instead.
+    if (size > ARENA_SIZE) return NULL;
     if (arena_ptr + size > ARENA_SIZE) {
         // Arena full, reset it (assumes previous allocations are no longer needed)
         arena_ptr = 0;
@@ -106,6 +166,32 @@ extern void host_log(uint32_t ptr, uint32_t len);
 __attribute__((import_module("env"), import_name("host_call_go")))
 extern uint32_t host_call_go(uint32_t ctx_ptr, uint32_t func_id, int32_t argc, uint32_t argv_ptr);
 
+// Eager-marshal variant: arguments arrive as one encoded buffer and the
+// result comes back the same way, so no per-argument crossings are needed.
+// Returns the response length, 0 for undefined, or UINT32_MAX if the
+// response did not fit in resp_cap bytes.
+__attribute__((import_module("env"), import_name("host_call_go_prim")))
+extern uint32_t host_call_go_prim(uint32_t ctx_ptr, uint32_t func_id,
+                                  uint32_t args_ptr, uint32_t args_len,
+                                  uint32_t resp_ptr, uint32_t resp_cap);
+
+// Timer scheduling lives on the host: setTimeout and friends hand the
+// callback's slot handle to Go, which owns the timer heap and fires the
+// handle back through qjs_call when the deadline passes. fn_handle 0 is a
+// bare wakeup asking the serve loop to drain pending jobs. Returns the
+// timer id (0 means scheduling is unavailable).
+__attribute__((import_module("env"), import_name("host_timer_schedule")))
+extern uint32_t host_timer_schedule(uint32_t ctx_ptr, uint32_t fn_handle,
+                                    double delay_ms, uint32_t repeat);
+
+__attribute__((import_module("env"), import_name("host_timer_cancel")))
+extern void host_timer_cancel(uint32_t timer_id);
+
+// Fired (at most once per arming) by the interrupt handler when the
+// engine's malloc counter crosses the soft memory watermark.
+__attribute__((import_module("env"), import_name("host_memory_watermark")))
+extern void host_memory_watermark(uint32_t rt_ptr, uint64_t used_bytes);
+
 // ============================================================================
 // Runtime and Context Management
 // ============================================================================
@@ -133,10 +219,14 @@ uint32_t qjs_new_context(uint32_t rt_ptr) {
     return (uint32_t)(uintptr_t)ctx;
 }
 
+static void baseline_drop(JSContext* ctx);
+
 __attribute__((export_name("qjs_free_context")))
 void qjs_free_context(uint32_t ctx_ptr) {
     if (!ctx_ptr) return;
-    JS_FreeContext((JSContext*)(uintptr_t)ctx_ptr);
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    baseline_drop(ctx);
+    JS_FreeContext(ctx);
 }
 
 __attribute__((export_name("qjs_get_runtime")))
@@ -146,6 +236,160 @@ uint32_t qjs_get_runtime(uint32_t ctx_ptr) {
     return (uint32_t)(uintptr_t)JS_GetRuntime(ctx);
 }
 
+// ============================================================================
+// Context Baseline and Reset (cheap reuse without intrinsic re-init)
+// ============================================================================
+
+// JS_NewContext rebuilds every intrinsic, which dominates per-request cost
+// when contexts are created per request. Instead, a context can snapshot the
+// global object's own string-keyed property names right after creation and
+// later delete everything added since, returning it to a like-new state
+// without touching the intrinsics. Baselines live outside the JS heap (plain
+// malloc, name strings copied out) so reset never races the GC.
+
+typedef struct {
+    JSContext* ctx;
+    char** names;
+    uint32_t count;
+} context_baseline;
+
+static context_baseline* baselines = NULL;
+static uint32_t baseline_count = 0;
+static uint32_t baseline_cap = 0;
+
+static context_baseline* baseline_find(JSContext* ctx) {
+    for (uint32_t i = 0; i < baseline_count; i++) {
+        if (baselines[i].ctx == ctx) return &baselines[i];
+    }
+    return NULL;
+}
+
+static void baseline_free_names(context_baseline* b) {
+    for (uint32_t i = 0; i < b->count; i++) free(b->names[i]);
+    free(b->names);
+    b->names = NULL;
+    b->count = 0;
+}
+
+// Forward-declared above qjs_free_context: a recycled context address must
+// not inherit the previous context's baseline.
+static void baseline_drop(JSContext* ctx) {
+    context_baseline* b = baseline_find(ctx);
+    if (!b) return;
+    baseline_free_names(b);
+    *b = baselines[--baseline_count];
+}
+
+static int baseline_has(context_baseline* b, const char* name) {
+    for (uint32_t i = 0; i < b->count; i++) {
+        if (!strcmp(b->names[i], name)) return 1;
+    }
+    return 0;
+}
+
+// Snapshot the global object's own string-keyed property names as the
+// context's baseline, replacing any previous snapshot. Returns 0 on
+// success, -1 on failure.
+__attribute__((export_name("qjs_context_baseline")))
+int32_t qjs_context_baseline(uint32_t ctx_ptr) {
+    if (!ctx_ptr) return -1;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+
+    JSValue global = JS_GetGlobalObject(ctx);
+    JSPropertyEnum* props;
+    uint32_t count;
+    if (JS_GetOwnPropertyNames(ctx, &props, &count, global, JS_GPN_STRING_MASK) < 0) {
+        JS_FreeValue(ctx, global);
+        return -1;
+    }
+    JS_FreeValue(ctx, global);
+
+    context_baseline* b = baseline_find(ctx);
+    if (!b) {
+        if (baseline_count == baseline_cap) {
+            uint32_t new_cap = baseline_cap ? baseline_cap * 2 : 8;
+            context_baseline* grown = realloc(baselines, new_cap * sizeof(*baselines));
+            if (!grown) goto fail;
+            baselines = grown;
+            baseline_cap = new_cap;
+        }
+        b = &baselines[baseline_count++];
+        b->ctx = ctx;
+        b->names = NULL;
+        b->count = 0;
+    } else {
+        baseline_free_names(b);
+    }
+
+    b->names = malloc(count * sizeof(char*));
+    if (count && !b->names) goto fail;
+    for (uint32_t i = 0; i < count; i++) {
+        const char* name = JS_AtomToCString(ctx, props[i].atom);
+        if (!name) {
+            baseline_free_names(b);
+            goto fail;
+        }
+        b->names[b->count] = strdup(name);
+        JS_FreeCString(ctx, name);
+        if (!b->names[b->count]) {
+            baseline_free_names(b);
+            goto fail;
+        }
+        b->count++;
+    }
+
+    for (uint32_t i = 0; i < count; i++) JS_FreeAtom(ctx, props[i].atom);
+    js_free(ctx, props);
+    return 0;
+
+fail:
+    for (uint32_t i = 0; i < count; i++) JS_FreeAtom(ctx, props[i].atom);
+    js_free(ctx, props);
+    return -1;
+}
+
+// Delete every own string-keyed global property added since the baseline
+// snapshot and clear any pending exception. Symbol-keyed globals are rare
+// enough in request handlers that they are left to the GC. Returns 0 on
+// success, -1 if no baseline exists or enumeration fails.
+__attribute__((export_name("qjs_context_reset")))
+int32_t qjs_context_reset(uint32_t ctx_ptr) {
+    if (!ctx_ptr) return -1;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+
+    context_baseline* b = baseline_find(ctx);
+    if (!b) return -1;
+
+    JSValue exc = JS_GetException(ctx);
+    JS_FreeValue(ctx, exc);
+
+    JSValue global = JS_GetGlobalObject(ctx);
+    JSPropertyEnum* props;
+    uint32_t count;
+    if (JS_GetOwnPropertyNames(ctx, &props, &count, global, JS_GPN_STRING_MASK) < 0) {
+        JS_FreeValue(ctx, global);
+        return -1;
+    }
+
+    int ret = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const char* name = JS_AtomToCString(ctx, props[i].atom);
+        if (!name) {
+            ret = -1;
+            break;
+        }
+        if (!baseline_has(b, name)) {
+            if (JS_DeleteProperty(ctx, global, props[i].atom, 0) < 0) ret = -1;
+        }
+        JS_FreeCString(ctx, name);
+    }
+
+    for (uint32_t i = 0; i < count; i++) JS_FreeAtom(ctx, props[i].atom);
+    js_free(ctx, props);
+    JS_FreeValue(ctx, global);
+    return ret;
+}
+
 // ============================================================================
 // Memory Allocation (for Go to write strings/data into WASM memory)
 // ============================================================================
@@ -171,9 +415,72 @@ uint32_t qjs_get_heap_size(void) {
     return ARENA_SIZE;
 }
 
+static uint64_t arena_resets = 0;
+
 __attribute__((export_name("qjs_reset_heap")))
 void qjs_reset_heap(void) {
     arena_ptr = 0;
+    arena_resets++;
+}
+
+// ============================================================================
+// Bridge Instrumentation (counters for the host's trace mode)
+// ============================================================================
+
+// Writes slot-table occupancy to out_ptr as 3 u32s: slots in use,
+// slots allocated, stale-handle uses.
+__attribute__((export_name("qjs_slot_stats")))
+void qjs_slot_stats(uint32_t out_ptr) {
+    if (!out_ptr) return;
+    uint32_t in_use = 0;
+    for (uint32_t i = 1; i < slot_count; i++) {
+        if (slot_at(i)->in_use) in_use++;
+    }
+    uint32_t* out = (uint32_t*)(uintptr_t)out_ptr;
+    out[0] = in_use;
+    out[1] = slot_count;
+    out[2] = stale_handle_uses;
+}
+
+// Writes arena state to out_ptr as 2 u32s (bytes in use, capacity)
+// followed by a u64 reset count.
+__attribute__((export_name("qjs_arena_stats")))
+void qjs_arena_stats(uint32_t out_ptr) {
+    if (!out_ptr) return;
+    uint32_t* out = (uint32_t*)(uintptr_t)out_ptr;
+    out[0] = (uint32_t)arena_ptr;
+    out[1] = ARENA_SIZE;
+    *(uint64_t*)(out + 2) = arena_resets;
+}
+
+// Reinitialize the JSValue slot table. Only valid after the owning runtime
+// has been freed (the slots hold JSValues that die with the runtime), e.g.
+// when recycling a WASM instance between pooled runtimes.
+__attribute__((export_name("qjs_reset_slots")))
+void qjs_reset_slots(void) {
+    init_jsvalue_slots();
+    first_free_slot = 0;
+    // Rebuild the freelist across all allocated chunks, bumping the
+    // generation of every slot that was still in use so surviving handles
+    // are invalidated rather than aliasing the next occupant.
+    for (uint32_t index = slot_count; index-- > 1; ) {
+        JSValueSlot* s = slot_at(index);
+        if (s->in_use) {
+            s->in_use = 0;
+            s->generation++;
+        }
+        s->value = JS_UNDEFINED;
+        s->next_free = first_free_slot;
+        first_free_slot = index;
+    }
+}
+
+// Number of slot accesses that presented a stale handle (the slot was
+// recycled after the handle was issued). Lets the host assert on
+// use-after-free instead of chasing silent undefineds.
+__attribute__((export_name("qjs_stale_handle_count")))
+uint32_t qjs_stale_handle_count(void) {
+    return stale_handle_uses;
 }
 
 // ============================================================================
@@ -206,6 +513,399 @@ uint32_t qjs_eval_module(uint32_t ctx_ptr, uint32_t code_ptr, uint32_t code_len,
     return store_jsvalue(result);
 }
 
+// Primitive-result fast path. qjs_eval/qjs_call store every result into the
+// slot table, and the host needs further crossings (type check, extraction,
+// free) to read a primitive back out. The _prim variants instead write a
+// tagged union — u32 tag, 8-byte payload at out_ptr+8 — into a caller
+// provided address, so a boolean or number round-trips in one crossing with
+// zero slot traffic. Non-primitives (objects, arrays, strings, functions)
+// fall back to a slot handle in the payload. Tags are mirrored in
+// internal/bridge/bridge.go.
+#define PRIM_RES_UNDEFINED 0
+#define PRIM_RES_NULL      1
+#define PRIM_RES_BOOL      2  // payload: 0 or 1
+#define PRIM_RES_INT32     3  // payload: zero-extended int32
+#define PRIM_RES_FLOAT64   4  // payload: double bits
+#define PRIM_RES_HANDLE    5  // payload: slot handle (non-primitive result)
+#define PRIM_RES_EXCEPTION 6  // exception left pending in the context
+
+static void prim_result(JSContext* ctx, JSValue result, uint32_t out_ptr) {
+    uint32_t* tag = (uint32_t*)(uintptr_t)out_ptr;
+    uint64_t* payload = (uint64_t*)(uintptr_t)(out_ptr + 8);
+    *payload = 0;
+    if (JS_IsException(result)) {
+        *tag = PRIM_RES_EXCEPTION;
+        return;
+    }
+    if (JS_IsUndefined(result)) {
+        *tag = PRIM_RES_UNDEFINED;
+        return;
+    }
+    if (JS_IsNull(result)) {
+        *tag = PRIM_RES_NULL;
+        return;
+    }
+    if (JS_IsBool(result)) {
+        *tag = PRIM_RES_BOOL;
+        *payload = JS_ToBool(ctx, result) ? 1 : 0;
+        return;
+    }
+    if (JS_IsNumber(result)) {
+        if (JS_VALUE_GET_TAG(result) == JS_TAG_INT) {
+            *tag = PRIM_RES_INT32;
+            *payload = (uint32_t)JS_VALUE_GET_INT(result);
+        } else {
+            double v;
+            JS_ToFloat64(ctx, &v, result);
+            *tag = PRIM_RES_FLOAT64;
+            memcpy(payload, &v, 8);
+        }
+        return;
+    }
+    *tag = PRIM_RES_HANDLE;
+    *payload = store_jsvalue(result);
+}
+
+// Like qjs_eval, but writes the result as a tagged union to out_ptr (16
+// bytes, 8-byte aligned) instead of always returning a slot handle.
+__attribute__((export_name("qjs_eval_prim")))
+void qjs_eval_prim(uint32_t ctx_ptr, uint32_t code_ptr, uint32_t code_len,
+                   uint32_t filename_ptr, int32_t flags, uint32_t out_ptr) {
+    if (!ctx_ptr || !code_ptr || !out_ptr) return;
+
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    const char* code = (const char*)(uintptr_t)code_ptr;
+    const char* filename = filename_ptr ? (const char*)(uintptr_t)filename_ptr : "<eval>";
+
+    JSValue result = JS_Eval(ctx, code, code_len, filename, flags);
+    prim_result(ctx, result, out_ptr);
+}
+
+// ============================================================================
+// Streaming Evaluation (chunked upload for scripts larger than the arena)
+// ============================================================================
+//
+// qjs_eval staged the whole script in the 4MB arena; bigger scripts now go
+// through begin/chunk/finish, which accumulates the bytes in engine-malloc'd
+// memory and hands JS_Eval the assembled buffer once. The runtime lock on
+// the Go side serializes bridge calls, so a single in-flight stream is
+// enough.
+
+static struct {
+    JSContext* ctx;
+    char* buf;
+    size_t len;
+    size_t cap;
+} eval_stream = { NULL, NULL, 0, 0 };
+
+static void eval_stream_reset(void) {
+    if (eval_stream.buf) js_free(eval_stream.ctx, eval_stream.buf);
+    eval_stream.ctx = NULL;
+    eval_stream.buf = NULL;
+    eval_stream.len = 0;
+    eval_stream.cap = 0;
+}
+
+// Open a stream, pre-sizing the buffer when the total is known (pass 0 if
+// not). Returns 1 on success, 0 on allocation failure or if a stream is
+// already open.
+__attribute__((export_name("qjs_eval_begin")))
+int32_t qjs_eval_begin(uint32_t ctx_ptr, uint32_t size_hint) {
+    if (!ctx_ptr || eval_stream.ctx) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+
+    size_t cap = size_hint ? (size_t)size_hint + 1 : 4096;
+    char* buf = js_malloc(ctx, cap);
+    if (!buf) return 0;
+
+    eval_stream.ctx = ctx;
+    eval_stream.buf = buf;
+    eval_stream.len = 0;
+    eval_stream.cap = cap;
+    return 1;
+}
+
+// Append one arena-staged chunk to the open stream. Returns 1 on success.
+__attribute__((export_name("qjs_eval_chunk")))
+int32_t qjs_eval_chunk(uint32_t chunk_ptr, uint32_t chunk_len) {
+    if (!eval_stream.ctx || !chunk_ptr) return 0;
+
+    if (eval_stream.len + chunk_len + 1 > eval_stream.cap) {
+        size_t cap = eval_stream.cap * 2;
+        while (cap < eval_stream.len + chunk_len + 1) cap *= 2;
+        char* buf = js_realloc(eval_stream.ctx, eval_stream.buf, cap);
+        if (!buf) {
+            eval_stream_reset();
+            return 0;
+        }
+        eval_stream.buf = buf;
+        eval_stream.cap = cap;
+    }
+    memcpy(eval_stream.buf + eval_stream.len, (const void*)(uintptr_t)chunk_ptr, chunk_len);
+    eval_stream.len += chunk_len;
+    return 1;
+}
+
+// Evaluate the assembled script and close the stream. Returns a slot handle
+// (0 if no stream is open).
+__attribute__((export_name("qjs_eval_finish")))
+uint32_t qjs_eval_finish(uint32_t filename_ptr, int32_t flags) {
+    if (!eval_stream.ctx) return 0;
+    JSContext* ctx = eval_stream.ctx;
+    const char* filename = filename_ptr ? (const char*)(uintptr_t)filename_ptr : "<eval>";
+
+    eval_stream.buf[eval_stream.len] = '\0';  // JS_Eval expects NUL-terminated input
+    JSValue result = JS_Eval(ctx, eval_stream.buf, eval_stream.len, filename, flags);
+    eval_stream_reset();
+    return store_jsvalue(result);
+}
+
+// Discard an open stream without evaluating (host-side upload failure).
+__attribute__((export_name("qjs_eval_abort")))
+void qjs_eval_abort(void) {
+    eval_stream_reset();
+}
+
+// ============================================================================
+// Precompiled Bytecode (JS_WriteObject / JS_ReadObject)
+// ============================================================================
+
+// Compile source to serialized bytecode without executing it. Returns a
+// js_malloc'd buffer (freed with qjs_free_bytecode) and writes its length to
+// out_len_ptr, or returns 0 with the exception left pending in the context.
+__attribute__((export_name("qjs_compile")))
+uint32_t qjs_compile(uint32_t ctx_ptr, uint32_t code_ptr, uint32_t code_len,
+                     uint32_t filename_ptr, int32_t flags, uint32_t out_len_ptr) {
+    if (!ctx_ptr || !code_ptr || !out_len_ptr) return 0;
+
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    const char* code = (const char*)(uintptr_t)code_ptr;
+    const char* filename = filename_ptr ? (const char*)(uintptr_t)filename_ptr : "<compile>";
+
+    JSValue obj = JS_Eval(ctx, code, code_len, filename, flags | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (JS_IsException(obj)) return 0;
+
+    size_t size;
+    uint8_t* buf = JS_WriteObject(ctx, &size, obj, JS_WRITE_OBJ_BYTECODE);
+    JS_FreeValue(ctx, obj);
+    if (!buf) return 0;
+
+    *(uint32_t*)(uintptr_t)out_len_ptr = (uint32_t)size;
+    return (uint32_t)(uintptr_t)buf;
+}
+
+__attribute__((export_name("qjs_free_bytecode")))
+void qjs_free_bytecode(uint32_t ctx_ptr, uint32_t buf_ptr) {
+    if (!ctx_ptr || !buf_ptr) return;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    js_free(ctx, (void*)(uintptr_t)buf_ptr);
+}
+
+// Serialize a value for structured-clone transfer to another runtime. Uses
+// the same object writer as qjs_compile but without the bytecode flag, so the
+// buffer is pure data (objects, arrays, typed arrays, ArrayBuffers, ...).
+// Returns a js_malloc'd buffer (freed with qjs_free_bytecode) and writes its
+// length to out_len_ptr, or returns 0 with the exception left pending.
+__attribute__((export_name("qjs_clone_write")))
+uint32_t qjs_clone_write(uint32_t ctx_ptr, uint32_t val_ptr, uint32_t out_len_ptr) {
+    if (!ctx_ptr || !out_len_ptr) return 0;
+
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue val = load_jsvalue(val_ptr);
+
+    size_t size;
+    uint8_t* buf = JS_WriteObject(ctx, &size, val, JS_WRITE_OBJ_REFERENCE);
+    if (!buf) return 0;
+
+    *(uint32_t*)(uintptr_t)out_len_ptr = (uint32_t)size;
+    return (uint32_t)(uintptr_t)buf;
+}
+
+// Deserialize a structured-clone buffer produced by qjs_clone_write, possibly
+// in a different context than the one that wrote it.
+__attribute__((export_name("qjs_clone_read")))
+uint32_t qjs_clone_read(uint32_t ctx_ptr, uint32_t buf_ptr, uint32_t buf_len) {
+    if (!ctx_ptr || !buf_ptr) return 0;
+
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    const uint8_t* buf = (const uint8_t*)(uintptr_t)buf_ptr;
+
+    return store_jsvalue(JS_ReadObject(ctx, buf, buf_len, JS_READ_OBJ_REFERENCE));
+}
+
+// Deserialize and execute bytecode produced by qjs_compile.
+__attribute__((export_name("qjs_eval_bytecode")))
+uint32_t qjs_eval_bytecode(uint32_t ctx_ptr, uint32_t buf_ptr, uint32_t buf_len) {
+    if (!ctx_ptr || !buf_ptr) return 0;
+
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    const uint8_t* buf = (const uint8_t*)(uintptr_t)buf_ptr;
+
+    JSValue obj = JS_ReadObject(ctx, buf, buf_len, JS_READ_OBJ_BYTECODE);
+    if (JS_IsException(obj)) return store_jsvalue(obj);
+
+    // Modules need their dependencies resolved before evaluation.
+    if (JS_VALUE_GET_TAG(obj) == JS_TAG_MODULE) {
+        if (JS_ResolveModule(ctx, obj) < 0) {
+            JS_FreeValue(ctx, obj);
+            return store_jsvalue(JS_EXCEPTION);
+        }
+    }
+
+    return store_jsvalue(JS_EvalFunction(ctx, obj));
+}
+
+// ============================================================================
+// Module Loader (host-resolved imports with compiled-module caching)
+// ============================================================================
+
+// Asks the host for a module. Returns a pointer to either source text
+// (*out_kind == 0) or serialized bytecode from the host's cache
+// (*out_kind == 1), with the byte length in *out_len; 0 if the specifier
+// cannot be resolved.
+__attribute__((import_module("env"), import_name("host_load_module")))
+extern uint32_t host_load_module(uint32_t ctx_ptr, uint32_t name_ptr, uint32_t name_len,
+                                 uint32_t out_len_ptr, uint32_t out_kind_ptr);
+
+// Hands a freshly compiled module's serialized form to the host cache.
+__attribute__((import_module("env"), import_name("host_store_module")))
+extern void host_store_module(uint32_t name_ptr, uint32_t name_len,
+                              uint32_t data_ptr, uint32_t data_len);
+
+static JSModuleDef* bridge_module_loader(JSContext* ctx, const char* module_name, void* opaque) {
+    (void)opaque;
+
+    uint32_t out_len = 0;
+    uint32_t out_kind = 0;
+    uint32_t buf_ptr = host_load_module((uint32_t)(uintptr_t)ctx,
+                                        (uint32_t)(uintptr_t)module_name,
+                                        (uint32_t)strlen(module_name),
+                                        (uint32_t)(uintptr_t)&out_len,
+                                        (uint32_t)(uintptr_t)&out_kind);
+    if (!buf_ptr) {
+        JS_ThrowReferenceError(ctx, "could not load module '%s'", module_name);
+        return NULL;
+    }
+
+    JSValue func_val;
+    if (out_kind == 1) {
+        // Cached compiled form from a previous load of this specifier.
+        func_val = JS_ReadObject(ctx, (const uint8_t*)(uintptr_t)buf_ptr, out_len,
+                                 JS_READ_OBJ_BYTECODE);
+    } else {
+        func_val = JS_Eval(ctx, (const char*)(uintptr_t)buf_ptr, out_len, module_name,
+                           JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+        if (!JS_IsException(func_val)) {
+            // Hand the compiled form to the host cache so later contexts
+            // skip the parse entirely.
+            size_t bc_len = 0;
+            uint8_t* bc = JS_WriteObject(ctx, &bc_len, func_val, JS_WRITE_OBJ_BYTECODE);
+            if (bc) {
+                host_store_module((uint32_t)(uintptr_t)module_name,
+                                  (uint32_t)strlen(module_name),
+                                  (uint32_t)(uintptr_t)bc, (uint32_t)bc_len);
+                js_free(ctx, bc);
+            }
+        }
+    }
+    if (JS_IsException(func_val)) return NULL;
+
+    JSModuleDef* m = JS_VALUE_GET_PTR(func_val);
+    JS_FreeValue(ctx, func_val);
+    return m;
+}
+
+__attribute__((export_name("qjs_enable_module_loader")))
+void qjs_enable_module_loader(uint32_t rt_ptr) {
+    if (!rt_ptr) return;
+    JSRuntime* rt = (JSRuntime*)(uintptr_t)rt_ptr;
+    JS_SetModuleLoaderFunc(rt, NULL, bridge_module_loader, NULL);
+}
+
+// ============================================================================
+// Host Timers (setTimeout/setInterval/queueMicrotask backed by Go)
+// ============================================================================
+
+// The engine has no event loop of its own; these natives only translate
+// between JS and the host's timer heap. A timer callback is dup'd into the
+// slot table and its handle scheduled with host_timer_schedule; Go fires it
+// via the ordinary qjs_call export and frees the slot when the timer dies.
+
+static JSValue js_timer_set(JSContext *ctx, JSValue this_val,
+                            int argc, JSValue *argv, int magic) {
+    (void)this_val;
+    if (argc < 1 || !JS_IsFunction(ctx, argv[0]))
+        return JS_ThrowTypeError(ctx, "callback must be a function");
+
+    double delay = 0;
+    if (argc > 1 && !JS_IsUndefined(argv[1])) {
+        if (JS_ToFloat64(ctx, &delay, argv[1])) return JS_EXCEPTION;
+        if (!(delay > 0)) delay = 0;  // NaN and negatives clamp to 0
+    }
+
+    uint32_t handle = store_jsvalue(JS_DupValue(ctx, argv[0]));
+    if (!handle) return JS_ThrowInternalError(ctx, "slot table exhausted");
+
+    uint32_t id = host_timer_schedule((uint32_t)(uintptr_t)ctx, handle, delay, magic);
+    if (!id) {
+        free_jsvalue_slot(handle);
+        return JS_ThrowInternalError(ctx, "no timer host (is Runtime.Serve running?)");
+    }
+    return JS_NewInt32(ctx, (int32_t)id);
+}
+
+static JSValue js_timer_clear(JSContext *ctx, JSValue this_val,
+                              int argc, JSValue *argv) {
+    (void)this_val;
+    int32_t id = 0;
+    if (argc > 0 && JS_ToInt32(ctx, &id, argv[0])) return JS_EXCEPTION;
+    if (id > 0) host_timer_cancel((uint32_t)id);
+    return JS_UNDEFINED;
+}
+
+static JSValue microtask_job(JSContext *ctx, int argc, JSValue *argv) {
+    (void)argc;
+    JSValue ret = JS_Call(ctx, argv[0], JS_UNDEFINED, 0, NULL);
+    if (JS_IsException(ret)) return ret;
+    JS_FreeValue(ctx, ret);
+    return JS_UNDEFINED;
+}
+
+static JSValue js_queue_microtask(JSContext *ctx, JSValue this_val,
+                                  int argc, JSValue *argv) {
+    (void)this_val;
+    if (argc < 1 || !JS_IsFunction(ctx, argv[0]))
+        return JS_ThrowTypeError(ctx, "callback must be a function");
+    if (JS_EnqueueJob(ctx, microtask_job, 1, argv) < 0) return JS_EXCEPTION;
+    // Nudge the serve loop so the job runs without waiting for a timer.
+    host_timer_schedule((uint32_t)(uintptr_t)ctx, 0, 0, 0);
+    return JS_UNDEFINED;
+}
+
+// Install setTimeout/setInterval/clearTimeout/clearInterval/queueMicrotask
+// on the context's global object. Timers only fire while Runtime.Serve is
+// driving the host timer heap.
+__attribute__((export_name("qjs_add_timers")))
+int32_t qjs_add_timers(uint32_t ctx_ptr) {
+    if (!ctx_ptr) return -1;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+
+    JSValue global = JS_GetGlobalObject(ctx);
+    int ret = 0;
+    ret |= JS_SetPropertyStr(ctx, global, "setTimeout",
+        JS_NewCFunctionMagic(ctx, js_timer_set, "setTimeout", 2, JS_CFUNC_generic_magic, 0)) < 0;
+    ret |= JS_SetPropertyStr(ctx, global, "setInterval",
+        JS_NewCFunctionMagic(ctx, js_timer_set, "setInterval", 2, JS_CFUNC_generic_magic, 1)) < 0;
+    ret |= JS_SetPropertyStr(ctx, global, "clearTimeout",
+        JS_NewCFunction(ctx, js_timer_clear, "clearTimeout", 1)) < 0;
+    ret |= JS_SetPropertyStr(ctx, global, "clearInterval",
+        JS_NewCFunction(ctx, js_timer_clear, "clearInterval", 1)) < 0;
+    ret |= JS_SetPropertyStr(ctx, global, "queueMicrotask",
+        JS_NewCFunction(ctx, js_queue_microtask, "queueMicrotask", 1)) < 0;
+    JS_FreeValue(ctx, global);
+    return ret ? -1 : 0;
+}
+
 // ============================================================================
 // Type Checking
 // ============================================================================
@@ -465,6 +1165,40 @@ int32_t qjs_delete_property(uint32_t ctx_ptr, uint32_t obj_ptr, uint32_t prop_pt
     return result;
 }
 
+// Atom-based property access: the host interns a property name once with
+// qjs_new_atom and passes the resulting atom on every subsequent access,
+// skipping the per-call string copy and UTF-8 decode.
+__attribute__((export_name("qjs_new_atom")))
+uint32_t qjs_new_atom(uint32_t ctx_ptr, uint32_t str_ptr, uint32_t len) {
+    if (!ctx_ptr || !str_ptr) return 0; // JS_ATOM_NULL
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    return (uint32_t)JS_NewAtomLen(ctx, (const char*)(uintptr_t)str_ptr, len);
+}
+
+__attribute__((export_name("qjs_free_atom")))
+void qjs_free_atom(uint32_t ctx_ptr, uint32_t atom) {
+    if (!ctx_ptr) return;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JS_FreeAtom(ctx, (JSAtom)atom);
+}
+
+__attribute__((export_name("qjs_get_property_atom")))
+uint32_t qjs_get_property_atom(uint32_t ctx_ptr, uint32_t obj_ptr, uint32_t atom) {
+    if (!ctx_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue obj = load_jsvalue(obj_ptr);
+    return store_jsvalue(JS_GetProperty(ctx, obj, (JSAtom)atom));
+}
+
+__attribute__((export_name("qjs_set_property_atom")))
+int32_t qjs_set_property_atom(uint32_t ctx_ptr, uint32_t obj_ptr, uint32_t atom, uint32_t val_ptr) {
+    if (!ctx_ptr) return -1;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue obj = load_jsvalue(obj_ptr);
+    JSValue val = load_jsvalue(val_ptr);
+    return JS_SetProperty(ctx, obj, (JSAtom)atom, JS_DupValue(ctx, val));
+}
+
 // Index-based property access (for arrays)
 __attribute__((export_name("qjs_get_property_uint32")))
 uint32_t qjs_get_property_uint32(uint32_t ctx_ptr, uint32_t obj_ptr, uint32_t idx) {
@@ -483,6 +1217,44 @@ int32_t qjs_set_property_uint32(uint32_t ctx_ptr, uint32_t obj_ptr, uint32_t idx
     return JS_SetPropertyUint32(ctx, obj, idx, JS_DupValue(ctx, val));
 }
 
+// Batched property access: names_ptr points at `count` concatenated
+// NUL-terminated property names so an entire batch costs one crossing.
+
+__attribute__((export_name("qjs_get_properties")))
+int32_t qjs_get_properties(uint32_t ctx_ptr, uint32_t obj_ptr, uint32_t names_ptr,
+                           int32_t count, uint32_t out_ptr) {
+    if (!ctx_ptr || !names_ptr || !out_ptr || count < 0) return -1;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue obj = load_jsvalue(obj_ptr);
+    const char* name = (const char*)(uintptr_t)names_ptr;
+    uint32_t* out = (uint32_t*)(uintptr_t)out_ptr;
+
+    for (int i = 0; i < count; i++) {
+        out[i] = store_jsvalue(JS_GetPropertyStr(ctx, obj, name));
+        name += strlen(name) + 1;
+    }
+    return 0;
+}
+
+__attribute__((export_name("qjs_set_properties")))
+int32_t qjs_set_properties(uint32_t ctx_ptr, uint32_t obj_ptr, uint32_t names_ptr,
+                           uint32_t vals_ptr, int32_t count) {
+    if (!ctx_ptr || !names_ptr || !vals_ptr || count < 0) return -1;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue obj = load_jsvalue(obj_ptr);
+    const char* name = (const char*)(uintptr_t)names_ptr;
+    uint32_t* vals = (uint32_t*)(uintptr_t)vals_ptr;
+
+    for (int i = 0; i < count; i++) {
+        JSValue val = load_jsvalue(vals[i]);
+        if (JS_SetPropertyStr(ctx, obj, name, JS_DupValue(ctx, val)) < 0) {
+            return -1;
+        }
+        name += strlen(name) + 1;
+    }
+    return 0;
+}
+
 // ============================================================================
 // Global Object
 // ============================================================================
@@ -522,6 +1294,34 @@ uint32_t qjs_call(uint32_t ctx_ptr, uint32_t func_ptr, uint32_t this_ptr,
     return store_jsvalue(result);
 }
 
+// Like qjs_call, but writes the result as a tagged union to out_ptr (see
+// prim_result) instead of always returning a slot handle.
+__attribute__((export_name("qjs_call_prim")))
+void qjs_call_prim(uint32_t ctx_ptr, uint32_t func_ptr, uint32_t this_ptr,
+                   int32_t argc, uint32_t argv_ptr, uint32_t out_ptr) {
+    if (!ctx_ptr || !out_ptr) return;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue func = load_jsvalue(func_ptr);
+    JSValue this_val = load_jsvalue(this_ptr);
+
+    JSValue* argv = NULL;
+    if (argc > 0 && argv_ptr) {
+        argv = (JSValue*)arena_alloc(sizeof(JSValue) * argc);
+        if (!argv) {
+            prim_result(ctx, JS_ThrowOutOfMemory(ctx), out_ptr);
+            return;
+        }
+
+        uint32_t* arg_ptrs = (uint32_t*)(uintptr_t)argv_ptr;
+        for (int i = 0; i < argc; i++) {
+            argv[i] = load_jsvalue(arg_ptrs[i]);
+        }
+    }
+
+    JSValue result = JS_Call(ctx, func, this_val, argc, argv);
+    prim_result(ctx, result, out_ptr);
+}
+
 __attribute__((export_name("qjs_call_constructor")))
 uint32_t qjs_call_constructor(uint32_t ctx_ptr, uint32_t func_ptr, 
                                int32_t argc, uint32_t argv_ptr) {
@@ -679,6 +1479,25 @@ uint32_t qjs_json_stringify(uint32_t ctx_ptr, uint32_t val_ptr) {
     return store_jsvalue(JS_JSONStringify(ctx, val, JS_UNDEFINED, JS_UNDEFINED));
 }
 
+// One-crossing stringify: serializes the value and returns a pointer to the
+// UTF-8 bytes in linear memory, writing their length to len_ptr. The host
+// reads the bytes in place (no intermediate string value slot, no extra
+// copy) and releases them with qjs_free_cstring. Returns 0 on exception.
+__attribute__((export_name("qjs_json_stringify_len")))
+uint32_t qjs_json_stringify_len(uint32_t ctx_ptr, uint32_t val_ptr, uint32_t len_ptr) {
+    if (!ctx_ptr || !len_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue val = load_jsvalue(val_ptr);
+
+    JSValue str = JS_JSONStringify(ctx, val, JS_UNDEFINED, JS_UNDEFINED);
+    if (JS_IsException(str)) return 0;
+
+    size_t* len = (size_t*)(uintptr_t)len_ptr;
+    const char* cstr = JS_ToCStringLen(ctx, len, str);
+    JS_FreeValue(ctx, str);
+    return (uint32_t)(uintptr_t)cstr;
+}
+
 // ============================================================================
 // Garbage Collection
 // ============================================================================
@@ -690,6 +1509,32 @@ void qjs_run_gc(uint32_t rt_ptr) {
     JS_RunGC(rt);
 }
 
+// Writes a packed subset of JS_ComputeMemoryUsage into out_ptr as 11
+// little-endian int64s: malloc_size, malloc_limit, memory_used_size,
+// malloc_count, atom_count, atom_size, str_count, str_size, obj_count,
+// obj_size, js_func_code_size.
+__attribute__((export_name("qjs_compute_memory_usage")))
+void qjs_compute_memory_usage(uint32_t rt_ptr, uint32_t out_ptr) {
+    if (!rt_ptr || !out_ptr) return;
+    JSRuntime* rt = (JSRuntime*)(uintptr_t)rt_ptr;
+
+    JSMemoryUsage u;
+    JS_ComputeMemoryUsage(rt, &u);
+
+    int64_t* out = (int64_t*)(uintptr_t)out_ptr;
+    out[0] = u.malloc_size;
+    out[1] = u.malloc_limit;
+    out[2] = u.memory_used_size;
+    out[3] = u.malloc_count;
+    out[4] = u.atom_count;
+    out[5] = u.atom_size;
+    out[6] = u.str_count;
+    out[7] = u.str_size;
+    out[8] = u.obj_count;
+    out[9] = u.obj_size;
+    out[10] = u.js_func_code_size;
+}
+
 // ============================================================================
 // Promise Handling
 // ============================================================================
@@ -736,10 +1581,41 @@ int32_t qjs_execute_pending_jobs(uint32_t rt_ptr) {
     while ((ret = JS_ExecutePendingJob(rt, &pctx)) > 0) {
         // Job executed
     }
-    
+
     return ret;
 }
 
+// Executes at most one pending job so the host can release its lock between
+// pumps. Returns 1 if a job ran, 0 if the queue was empty, -1 on error.
+__attribute__((export_name("qjs_execute_pending_job")))
+int32_t qjs_execute_pending_job(uint32_t rt_ptr) {
+    if (!rt_ptr) return -1;
+    JSRuntime* rt = (JSRuntime*)(uintptr_t)rt_ptr;
+    JSContext* pctx;
+    return JS_ExecutePendingJob(rt, &pctx);
+}
+
+// Returns the promise state: 0 pending, 1 fulfilled, 2 rejected,
+// or -1 if the value is not a promise.
+__attribute__((export_name("qjs_promise_state")))
+int32_t qjs_promise_state(uint32_t ctx_ptr, uint32_t val_ptr) {
+    if (!ctx_ptr) return -1;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue val = load_jsvalue(val_ptr);
+
+    return (int32_t)JS_PromiseState(ctx, val);
+}
+
+// Returns the settled value (fulfillment value or rejection reason) of a
+// promise. Only meaningful once qjs_promise_state reports non-pending.
+__attribute__((export_name("qjs_promise_result")))
+uint32_t qjs_promise_result(uint32_t ctx_ptr, uint32_t val_ptr) {
+    if (!ctx_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue val = load_jsvalue(val_ptr);
+    return store_jsvalue(JS_PromiseResult(ctx, val));
+}
+
 // ============================================================================
 // BigInt Support
 // ============================================================================
@@ -869,11 +1745,385 @@ uint32_t qjs_get_array_buffer(uint32_t ctx_ptr, uint32_t val_ptr, uint32_t len_p
     if (!ctx_ptr || !len_ptr) return 0;
     JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
     size_t* len = (size_t*)(uintptr_t)len_ptr;
-    
+
     uint8_t* buf = JS_GetArrayBuffer(ctx, len, load_jsvalue(val_ptr));
     return (uint32_t)(uintptr_t)buf;
 }
 
+// Create a typed array of the given JSTypedArrayEnum type over a fresh
+// zeroed buffer of byte_len bytes, exposing the backing store to the host
+// so Go fills the packed element data with one Memory.Write. Writes the
+// data address to out_data_ptr (0 on failure) and returns a slot handle.
+__attribute__((export_name("qjs_new_typed_array")))
+uint32_t qjs_new_typed_array(uint32_t ctx_ptr, int32_t array_type, uint32_t byte_len, uint32_t out_data_ptr) {
+    if (!ctx_ptr || !out_data_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    *(uint32_t*)(uintptr_t)out_data_ptr = 0;
+
+    JSValue buffer = JS_NewArrayBufferCopy(ctx, NULL, byte_len);
+    if (JS_IsException(buffer)) return store_jsvalue(buffer);
+
+    JSValue arr = JS_NewTypedArray(ctx, 1, &buffer, (JSTypedArrayEnum)array_type);
+    if (JS_IsException(arr)) {
+        JS_FreeValue(ctx, buffer);
+        return store_jsvalue(arr);
+    }
+
+    size_t size;
+    uint8_t* data = JS_GetArrayBuffer(ctx, &size, buffer);
+    JS_FreeValue(ctx, buffer);  // the typed array keeps it alive
+    *(uint32_t*)(uintptr_t)out_data_ptr = (uint32_t)(uintptr_t)data;
+    return store_jsvalue(arr);
+}
+
+// Describe a typed array for bulk reads: writes data address (including the
+// view's byte offset), byte length, bytes per element and the
+// JSTypedArrayEnum type as four u32s. Returns 1 on success, 0 if the value
+// is not a typed array.
+__attribute__((export_name("qjs_get_typed_array_info")))
+int32_t qjs_get_typed_array_info(uint32_t ctx_ptr, uint32_t val_ptr, uint32_t out_ptr) {
+    if (!ctx_ptr || !out_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue val = load_jsvalue(val_ptr);
+
+    int type = JS_GetTypedArrayType(val);
+    if (type < 0) return 0;
+
+    size_t byte_offset, byte_length, bytes_per_element;
+    JSValue buffer = JS_GetTypedArrayBuffer(ctx, val, &byte_offset, &byte_length, &bytes_per_element);
+    if (JS_IsException(buffer)) return 0;
+
+    size_t size;
+    uint8_t* data = JS_GetArrayBuffer(ctx, &size, buffer);
+    JS_FreeValue(ctx, buffer);
+    if (!data) return 0;
+
+    uint32_t* out = (uint32_t*)(uintptr_t)out_ptr;
+    out[0] = (uint32_t)(uintptr_t)(data + byte_offset);
+    out[1] = (uint32_t)byte_length;
+    out[2] = (uint32_t)bytes_per_element;
+    out[3] = (uint32_t)type;
+    return 1;
+}
+
+// ============================================================================
+// Direct Struct Marshaling
+// ============================================================================
+//
+// Go serializes a whole object graph into one packed buffer which
+// qjs_build_value materializes natively, and qjs_encode_value does the
+// reverse, so deep conversions cost one crossing instead of one per node.
+//
+// Wire format (little endian), shared with the Go side in marshal.go:
+//   tag 0 undefined, 1 null, 2 false, 3 true,
+//   4 int32,  5 float64, 6 string (u32 len + bytes),
+//   7 array  (u32 count + elements),
+//   8 object (u32 count + (u32 keylen + key + value)*)
+
+#define MARSHAL_MAX_DEPTH 64
+
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+} marshal_reader;
+
+static int marshal_read(marshal_reader* r, void* out, size_t n) {
+    if ((size_t)(r->end - r->p) < n) return -1;
+    memcpy(out, r->p, n);
+    r->p += n;
+    return 0;
+}
+
+static JSValue build_value(JSContext* ctx, marshal_reader* r, int depth) {
+    uint8_t tag;
+    if (depth > MARSHAL_MAX_DEPTH)
+        return JS_ThrowInternalError(ctx, "marshal buffer too deeply nested");
+    if (marshal_read(r, &tag, 1))
+        return JS_ThrowInternalError(ctx, "truncated marshal buffer");
+
+    switch (tag) {
+    case 0: return JS_UNDEFINED;
+    case 1: return JS_NULL;
+    case 2: return JS_FALSE;
+    case 3: return JS_TRUE;
+    case 4: {
+        int32_t v;
+        if (marshal_read(r, &v, 4)) break;
+        return JS_NewInt32(ctx, v);
+    }
+    case 5: {
+        double v;
+        if (marshal_read(r, &v, 8)) break;
+        return JS_NewFloat64(ctx, v);
+    }
+    case 6: {
+        uint32_t len;
+        if (marshal_read(r, &len, 4)) break;
+        if ((size_t)(r->end - r->p) < len) break;
+        JSValue s = JS_NewStringLen(ctx, (const char*)r->p, len);
+        r->p += len;
+        return s;
+    }
+    case 7: {
+        uint32_t count;
+        if (marshal_read(r, &count, 4)) break;
+        JSValue arr = JS_NewArray(ctx);
+        if (JS_IsException(arr)) return arr;
+        for (uint32_t i = 0; i < count; i++) {
+            JSValue elem = build_value(ctx, r, depth + 1);
+            if (JS_IsException(elem)) {
+                JS_FreeValue(ctx, arr);
+                return elem;
+            }
+            JS_SetPropertyUint32(ctx, arr, i, elem);
+        }
+        return arr;
+    }
+    case 8: {
+        uint32_t count;
+        if (marshal_read(r, &count, 4)) break;
+        JSValue obj = JS_NewObject(ctx);
+        if (JS_IsException(obj)) return obj;
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t keylen;
+            if (marshal_read(r, &keylen, 4) || (size_t)(r->end - r->p) < keylen) {
+                JS_FreeValue(ctx, obj);
+                return JS_ThrowInternalError(ctx, "truncated marshal buffer");
+            }
+            JSAtom key = JS_NewAtomLen(ctx, (const char*)r->p, keylen);
+            r->p += keylen;
+            JSValue val = build_value(ctx, r, depth + 1);
+            if (JS_IsException(val)) {
+                JS_FreeAtom(ctx, key);
+                JS_FreeValue(ctx, obj);
+                return val;
+            }
+            JS_SetProperty(ctx, obj, key, val);
+            JS_FreeAtom(ctx, key);
+        }
+        return obj;
+    }
+    default:
+        return JS_ThrowInternalError(ctx, "bad marshal tag %d", tag);
+    }
+    return JS_ThrowInternalError(ctx, "truncated marshal buffer");
+}
+
+__attribute__((export_name("qjs_build_value")))
+uint32_t qjs_build_value(uint32_t ctx_ptr, uint32_t buf_ptr, uint32_t buf_len) {
+    if (!ctx_ptr || !buf_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    marshal_reader r = {
+        (const uint8_t*)(uintptr_t)buf_ptr,
+        (const uint8_t*)(uintptr_t)buf_ptr + buf_len,
+    };
+    return store_jsvalue(build_value(ctx, &r, 0));
+}
+
+typedef struct {
+    JSContext* ctx;
+    uint8_t* buf;
+    size_t len;
+    size_t cap;
+} marshal_writer;
+
+static int marshal_write(marshal_writer* w, const void* data, size_t n) {
+    if (w->len + n > w->cap) {
+        size_t cap = w->cap ? w->cap * 2 : 256;
+        while (cap < w->len + n) cap *= 2;
+        uint8_t* buf = js_realloc(w->ctx, w->buf, cap);
+        if (!buf) return -1;
+        w->buf = buf;
+        w->cap = cap;
+    }
+    memcpy(w->buf + w->len, data, n);
+    w->len += n;
+    return 0;
+}
+
+static int marshal_write_tag(marshal_writer* w, uint8_t tag) {
+    return marshal_write(w, &tag, 1);
+}
+
+static int encode_value(JSContext* ctx, marshal_writer* w, JSValue val, int depth);
+
+static int encode_string(JSContext* ctx, marshal_writer* w, JSValue val) {
+    size_t len;
+    const char* str = JS_ToCStringLen(ctx, &len, val);
+    if (!str) return -1;
+    uint32_t len32 = (uint32_t)len;
+    int ret = marshal_write_tag(w, 6) || marshal_write(w, &len32, 4) ||
+              marshal_write(w, str, len);
+    JS_FreeCString(ctx, str);
+    return ret ? -1 : 0;
+}
+
+static int encode_value(JSContext* ctx, marshal_writer* w, JSValue val, int depth) {
+    if (depth > MARSHAL_MAX_DEPTH) return -1;
+
+    if (JS_IsUndefined(val)) return marshal_write_tag(w, 0);
+    if (JS_IsNull(val)) return marshal_write_tag(w, 1);
+    if (JS_IsBool(val)) return marshal_write_tag(w, JS_ToBool(ctx, val) ? 3 : 2);
+    if (JS_IsNumber(val)) {
+        if (JS_VALUE_GET_TAG(val) == JS_TAG_INT) {
+            int32_t v = JS_VALUE_GET_INT(val);
+            return marshal_write_tag(w, 4) || marshal_write(w, &v, 4) ? -1 : 0;
+        }
+        double v;
+        if (JS_ToFloat64(ctx, &v, val)) return -1;
+        return marshal_write_tag(w, 5) || marshal_write(w, &v, 8) ? -1 : 0;
+    }
+    if (JS_IsString(val)) return encode_string(ctx, w, val);
+    if (JS_IsArray(val)) {
+        JSValue len_val = JS_GetPropertyStr(ctx, val, "length");
+        uint32_t count = 0;
+        if (JS_ToUint32(ctx, &count, len_val)) {
+            JS_FreeValue(ctx, len_val);
+            return -1;
+        }
+        JS_FreeValue(ctx, len_val);
+        if (marshal_write_tag(w, 7) || marshal_write(w, &count, 4)) return -1;
+        for (uint32_t i = 0; i < count; i++) {
+            JSValue elem = JS_GetPropertyUint32(ctx, val, i);
+            if (JS_IsException(elem)) return -1;
+            int ret = encode_value(ctx, w, elem, depth + 1);
+            JS_FreeValue(ctx, elem);
+            if (ret) return -1;
+        }
+        return 0;
+    }
+    if (JS_IsObject(val) && !JS_IsFunction(ctx, val)) {
+        JSPropertyEnum* props;
+        uint32_t count;
+        if (JS_GetOwnPropertyNames(ctx, &props, &count, val,
+                                   JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0) {
+            return -1;
+        }
+        int ret = marshal_write_tag(w, 8) || marshal_write(w, &count, 4);
+        for (uint32_t i = 0; i < count && !ret; i++) {
+            const char* key = JS_AtomToCString(ctx, props[i].atom);
+            if (!key) {
+                ret = -1;
+                break;
+            }
+            uint32_t keylen = (uint32_t)strlen(key);
+            ret = marshal_write(w, &keylen, 4) || marshal_write(w, key, keylen);
+            JS_FreeCString(ctx, key);
+            if (!ret) {
+                JSValue prop = JS_GetProperty(ctx, val, props[i].atom);
+                if (JS_IsException(prop)) {
+                    ret = -1;
+                } else {
+                    ret = encode_value(ctx, w, prop, depth + 1);
+                    JS_FreeValue(ctx, prop);
+                }
+            }
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            JS_FreeAtom(ctx, props[i].atom);
+        }
+        js_free(ctx, props);
+        return ret ? -1 : 0;
+    }
+    // Functions, symbols and other exotic values are not serializable.
+    return marshal_write_tag(w, 0);
+}
+
+// Encode a JS value graph into the marshal wire format. Returns a js_malloc'd
+// buffer (freed with qjs_free_encoded) and writes its length to out_len_ptr,
+// or 0 on failure.
+__attribute__((export_name("qjs_encode_value")))
+uint32_t qjs_encode_value(uint32_t ctx_ptr, uint32_t val_ptr, uint32_t out_len_ptr) {
+    if (!ctx_ptr || !out_len_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    marshal_writer w = { ctx, NULL, 0, 0 };
+
+    if (encode_value(ctx, &w, load_jsvalue(val_ptr), 0)) {
+        js_free(ctx, w.buf);
+        return 0;
+    }
+    *(uint32_t*)(uintptr_t)out_len_ptr = (uint32_t)w.len;
+    return (uint32_t)(uintptr_t)w.buf;
+}
+
+__attribute__((export_name("qjs_free_encoded")))
+void qjs_free_encoded(uint32_t ctx_ptr, uint32_t buf_ptr) {
+    if (!ctx_ptr || !buf_ptr) return;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    js_free(ctx, (void*)(uintptr_t)buf_ptr);
+}
+
+// Enumerate an object's own enumerable string-keyed properties in one
+// crossing: u32 count, then per property u32 key length + key bytes,
+// followed by the marshal-encoded value when with_values is set. Only the
+// top level is walked; values encode their full graph like qjs_encode_value.
+// Returns a js_malloc'd buffer (freed with qjs_free_encoded) and writes its
+// length to out_len_ptr, or 0 on failure.
+__attribute__((export_name("qjs_own_properties")))
+uint32_t qjs_own_properties(uint32_t ctx_ptr, uint32_t val_ptr, int32_t with_values,
+                            uint32_t out_len_ptr) {
+    if (!ctx_ptr || !out_len_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue val = load_jsvalue(val_ptr);
+    if (!JS_IsObject(val)) return 0;
+
+    JSPropertyEnum* props;
+    uint32_t count;
+    if (JS_GetOwnPropertyNames(ctx, &props, &count, val,
+                               JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0) {
+        return 0;
+    }
+
+    marshal_writer w = { ctx, NULL, 0, 0 };
+    int ret = marshal_write(&w, &count, 4);
+    for (uint32_t i = 0; i < count && !ret; i++) {
+        const char* key = JS_AtomToCString(ctx, props[i].atom);
+        if (!key) {
+            ret = -1;
+            break;
+        }
+        uint32_t keylen = (uint32_t)strlen(key);
+        ret = marshal_write(&w, &keylen, 4) || marshal_write(&w, key, keylen);
+        JS_FreeCString(ctx, key);
+        if (!ret && with_values) {
+            JSValue prop = JS_GetProperty(ctx, val, props[i].atom);
+            if (JS_IsException(prop)) {
+                ret = -1;
+            } else {
+                ret = encode_value(ctx, &w, prop, 1);
+                JS_FreeValue(ctx, prop);
+            }
+        }
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        JS_FreeAtom(ctx, props[i].atom);
+    }
+    js_free(ctx, props);
+
+    if (ret) {
+        js_free(ctx, w.buf);
+        return 0;
+    }
+    *(uint32_t*)(uintptr_t)out_len_ptr = (uint32_t)w.len;
+    return (uint32_t)(uintptr_t)w.buf;
+}
+
+// Create an ArrayBuffer whose (zeroed) backing store is exposed to the host
+// so Go can fill it in place instead of staging a copy through the arena.
+__attribute__((export_name("qjs_new_uninit_array_buffer")))
+uint32_t qjs_new_uninit_array_buffer(uint32_t ctx_ptr, uint32_t len, uint32_t out_data_ptr) {
+    if (!ctx_ptr || !out_data_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+
+    JSValue ab = JS_NewArrayBufferCopy(ctx, NULL, len);
+    if (JS_IsException(ab)) return store_jsvalue(ab);
+
+    size_t size;
+    uint8_t* data = JS_GetArrayBuffer(ctx, &size, ab);
+    *(uint32_t*)(uintptr_t)out_data_ptr = (uint32_t)(uintptr_t)data;
+    return store_jsvalue(ab);
+}
+
 // ============================================================================
 // Console/Print Support (using host_log)
 // ============================================================================
@@ -974,6 +2224,175 @@ uint32_t qjs_new_c_function(uint32_t ctx_ptr, uint32_t func_id, uint32_t name_pt
     return store_jsvalue(func);
 }
 
+// Eager-marshal callback path. go_callback_wrapper crosses the boundary once
+// per argument (store_jsvalue) plus once per Go-side inspection; for
+// primitive-heavy callbacks this wrapper instead encodes all arguments into
+// one marshal buffer (u32 argc + encoded values) and decodes the result from
+// a single response buffer, collapsing the whole call into two crossings.
+#define PRIM_RESPONSE_CAP 65536
+#define PRIM_RESPONSE_OVERFLOW 0xFFFFFFFFu
+
+static JSValue go_callback_wrapper_prim(JSContext *ctx, JSValue this_val,
+                                        int argc, JSValue *argv, int magic,
+                                        JSValue *func_data) {
+    int32_t func_id;
+    JS_ToInt32(ctx, &func_id, func_data[0]);
+
+    marshal_writer w = { ctx, NULL, 0, 0 };
+    uint32_t count = (uint32_t)argc;
+    int ret = marshal_write(&w, &count, 4);
+    for (int i = 0; i < argc && !ret; i++) {
+        ret = encode_value(ctx, &w, argv[i], 0);
+    }
+    if (ret) {
+        js_free(ctx, w.buf);
+        return JS_ThrowInternalError(ctx, "failed to encode callback arguments");
+    }
+
+    uint8_t* resp = (uint8_t*)arena_alloc(PRIM_RESPONSE_CAP);
+    uint32_t resp_len = host_call_go_prim(
+        (uint32_t)(uintptr_t)ctx,
+        func_id,
+        (uint32_t)(uintptr_t)w.buf,
+        (uint32_t)w.len,
+        (uint32_t)(uintptr_t)resp,
+        PRIM_RESPONSE_CAP
+    );
+    js_free(ctx, w.buf);
+
+    if (resp_len == 0) return JS_UNDEFINED;
+    if (resp_len == PRIM_RESPONSE_OVERFLOW)
+        return JS_ThrowRangeError(ctx, "callback result exceeds %d bytes",
+                                  PRIM_RESPONSE_CAP);
+    marshal_reader r = { resp, resp + resp_len };
+    return build_value(ctx, &r, 0);
+}
+
+__attribute__((export_name("qjs_new_c_function_prim")))
+uint32_t qjs_new_c_function_prim(uint32_t ctx_ptr, uint32_t func_id, uint32_t name_ptr, int32_t arg_count) {
+    if (!ctx_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    const char* name = name_ptr ? (const char*)(uintptr_t)name_ptr : "";
+
+    JSValue func_data[1];
+    func_data[0] = JS_NewInt32(ctx, func_id);
+
+    JSValue func = JS_NewCFunctionData(ctx, go_callback_wrapper_prim, arg_count, 0, 1, func_data);
+
+    if (name[0]) {
+        JS_DefinePropertyValueStr(ctx, func, "name",
+                                  JS_NewString(ctx, name), JS_PROP_CONFIGURABLE);
+    }
+
+    return store_jsvalue(func);
+}
+
+// ============================================================================
+// JS/Go Channel (lock-free single-producer ring buffer)
+// ============================================================================
+//
+// A fixed region of linear memory written directly by Go (no runtime lock,
+// no crossing per event) and drained here in batches. Records are
+// 4-byte-length-prefixed marshal-encoded values laid out contiguously; a
+// producer that cannot fit a record before the end of the buffer writes a
+// wrap marker (or implicitly wraps when fewer than 4 bytes remain) and
+// continues at offset 0. head (consumer, owned here) and tail (producer,
+// owned by Go) are byte offsets into the ring, exposed by address so the
+// Go side reads and writes them straight through linear memory.
+
+#define CHANNEL_CAP  (1u << 20)
+#define CHANNEL_WRAP 0xFFFFFFFFu
+
+static uint8_t channel_buf[CHANNEL_CAP];
+static volatile uint32_t channel_head = 0;  // next byte to consume
+static volatile uint32_t channel_tail = 0;  // next byte to produce (Go-owned)
+static JSContext* channel_ctx = NULL;
+static JSValue channel_cb;
+
+// Open the channel with a JS callback that receives each drained batch as
+// an array. Returns 1 on success, 0 if a channel is already open.
+__attribute__((export_name("qjs_channel_init")))
+int32_t qjs_channel_init(uint32_t ctx_ptr, uint32_t cb_ptr) {
+    if (!ctx_ptr || channel_ctx) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JSValue cb = load_jsvalue(cb_ptr);
+    if (!JS_IsFunction(ctx, cb)) return 0;
+
+    channel_ctx = ctx;
+    channel_cb = JS_DupValue(ctx, cb);
+    channel_head = 0;
+    channel_tail = 0;
+    return 1;
+}
+
+__attribute__((export_name("qjs_channel_close")))
+void qjs_channel_close(void) {
+    if (!channel_ctx) return;
+    JS_FreeValue(channel_ctx, channel_cb);
+    channel_ctx = NULL;
+}
+
+// Write the ring layout (buffer address, capacity, head address, tail
+// address) as four u32s so the producer can operate on linear memory
+// without further calls.
+__attribute__((export_name("qjs_channel_layout")))
+void qjs_channel_layout(uint32_t out_ptr) {
+    if (!out_ptr) return;
+    uint32_t* out = (uint32_t*)(uintptr_t)out_ptr;
+    out[0] = (uint32_t)(uintptr_t)channel_buf;
+    out[1] = CHANNEL_CAP;
+    out[2] = (uint32_t)(uintptr_t)&channel_head;
+    out[3] = (uint32_t)(uintptr_t)&channel_tail;
+}
+
+// Drain every complete record currently in the ring and deliver them to the
+// callback as one array. Returns the number of events delivered, or -1 if
+// decoding or the callback threw.
+__attribute__((export_name("qjs_channel_poll")))
+int32_t qjs_channel_poll(void) {
+    if (!channel_ctx) return -1;
+    JSContext* ctx = channel_ctx;
+
+    uint32_t head = channel_head;
+    uint32_t tail = channel_tail;  // snapshot; producer may append meanwhile
+    if (head == tail) return 0;
+
+    JSValue batch = JS_NewArray(ctx);
+    if (JS_IsException(batch)) return -1;
+    uint32_t count = 0;
+
+    while (head != tail) {
+        if (CHANNEL_CAP - head < 4) {
+            head = 0;
+            continue;
+        }
+        uint32_t len;
+        memcpy(&len, channel_buf + head, 4);
+        if (len == CHANNEL_WRAP) {
+            head = 0;
+            continue;
+        }
+        head += 4;
+        marshal_reader r = { channel_buf + head, channel_buf + head + len };
+        JSValue v = build_value(ctx, &r, 0);
+        if (JS_IsException(v)) {
+            JS_FreeValue(ctx, batch);
+            channel_head = (head + len) % CHANNEL_CAP;  // drop the malformed record
+            return -1;
+        }
+        JS_SetPropertyUint32(ctx, batch, count++, v);
+        head += len;
+        if (head == CHANNEL_CAP) head = 0;
+    }
+    channel_head = head;
+
+    JSValue result = JS_Call(ctx, channel_cb, JS_UNDEFINED, 1, &batch);
+    JS_FreeValue(ctx, batch);
+    if (JS_IsException(result)) return -1;
+    JS_FreeValue(ctx, result);
+    return (int32_t)count;
+}
+
 // ============================================================================
 // Strict Equality
 // ============================================================================
@@ -1006,6 +2425,314 @@ void qjs_set_max_stack_size(uint32_t rt_ptr, uint32_t stack_size) {
     JS_SetMaxStackSize(rt, stack_size);
 }
 
+// Raising the threshold defers the engine's own allocation-triggered GC so
+// the host can schedule collections at idle points instead.
+__attribute__((export_name("qjs_set_gc_threshold")))
+void qjs_set_gc_threshold(uint32_t rt_ptr, uint32_t threshold) {
+    if (!rt_ptr) return;
+    JSRuntime* rt = (JSRuntime*)(uintptr_t)rt_ptr;
+    JS_SetGCThreshold(rt, threshold);
+}
+
+// Soft memory watermark. Where JS_SetMemoryLimit fails the allocation that
+// crosses it — an opaque exception mid-eval and a context the host must
+// destroy — the watermark only notifies: the interrupt handler compares the
+// engine's malloc counter against it every JS_INTERRUPT_COUNTER_INIT
+// opcodes and calls host_memory_watermark once when crossed, leaving time
+// to GC or shed load before the hard limit hits. One-shot until re-armed.
+static int bridge_interrupt_handler(JSRuntime* rt, void* opaque);
+
+static uint64_t watermark_limit = 0;
+static int watermark_fired = 0;
+
+static void watermark_check(JSRuntime* rt) {
+    if (!watermark_limit || watermark_fired) return;
+    uint64_t used = (uint64_t)JS_GetMallocSize(rt);
+    if (used >= watermark_limit) {
+        watermark_fired = 1;
+        host_memory_watermark((uint32_t)(uintptr_t)rt, used);
+    }
+}
+
+// Arm (or, with bytes 0, disarm) the watermark and install the interrupt
+// handler that polls it. Re-arming resets the one-shot latch.
+__attribute__((export_name("qjs_set_memory_watermark")))
+void qjs_set_memory_watermark(uint32_t rt_ptr, uint64_t bytes) {
+    if (!rt_ptr) return;
+    JSRuntime* rt = (JSRuntime*)(uintptr_t)rt_ptr;
+    watermark_limit = bytes;
+    watermark_fired = 0;
+    if (bytes) JS_SetInterruptHandler(rt, bridge_interrupt_handler, NULL);
+}
+
+// ============================================================================
+// Regex Compilation Cache
+// ============================================================================
+//
+// js_compile_regexp (behind QJS_BRIDGE_REGEXP_CACHE in quickjs.c) consults
+// this table before calling lre_compile and stores every successful
+// compilation, so workloads that apply the same patterns in thousands of
+// short-lived contexts pay libregexp's compile cost once per process
+// instead of once per context. Entries are plain-malloc'd because the
+// cache outlives every runtime and context. Lookup is a linear scan; the
+// table is sized for pattern sets, not pattern churn, and stops accepting
+// entries when full.
+
+#define REGEXP_CACHE_MAX 256
+
+typedef struct {
+    char* pattern;
+    size_t pattern_len;
+    int flags;
+    uint8_t* bytecode;
+    int bytecode_len;
+} regexp_cache_entry;
+
+static regexp_cache_entry regexp_cache[REGEXP_CACHE_MAX];
+static uint32_t regexp_cache_count = 0;
+static uint64_t regexp_cache_hits = 0;
+static uint64_t regexp_cache_misses = 0;
+
+const uint8_t* qjs_regexp_cache_lookup(const char* pattern, size_t pattern_len,
+                                       int re_flags, int* out_len) {
+    for (uint32_t i = 0; i < regexp_cache_count; i++) {
+        regexp_cache_entry* e = &regexp_cache[i];
+        if (e->flags == re_flags && e->pattern_len == pattern_len &&
+            memcmp(e->pattern, pattern, pattern_len) == 0) {
+            regexp_cache_hits++;
+            *out_len = e->bytecode_len;
+            return e->bytecode;
+        }
+    }
+    regexp_cache_misses++;
+    return NULL;
+}
+
+void qjs_regexp_cache_store(const char* pattern, size_t pattern_len,
+                            int re_flags, const uint8_t* bc, int bc_len) {
+    if (regexp_cache_count == REGEXP_CACHE_MAX) return;
+    regexp_cache_entry* e = &regexp_cache[regexp_cache_count];
+
+    e->pattern = malloc(pattern_len);
+    e->bytecode = malloc(bc_len);
+    if (!e->pattern || !e->bytecode) {
+        free(e->pattern);
+        free(e->bytecode);
+        return;
+    }
+    memcpy(e->pattern, pattern, pattern_len);
+    memcpy(e->bytecode, bc, bc_len);
+    e->pattern_len = pattern_len;
+    e->flags = re_flags;
+    e->bytecode_len = bc_len;
+    regexp_cache_count++;
+}
+
+// Compile a pattern through the global RegExp constructor so the result
+// lands in the cache. flags_ptr may be 0. Returns 1 on success, 0 if the
+// pattern does not compile.
+__attribute__((export_name("qjs_precompile_regexp")))
+int32_t qjs_precompile_regexp(uint32_t ctx_ptr, uint32_t pattern_ptr, uint32_t pattern_len, uint32_t flags_ptr) {
+    if (!ctx_ptr || !pattern_ptr) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+
+    JSValue global = JS_GetGlobalObject(ctx);
+    JSValue ctor = JS_GetPropertyStr(ctx, global, "RegExp");
+    JS_FreeValue(ctx, global);
+    if (JS_IsException(ctor)) return 0;
+
+    JSValue argv[2];
+    int argc = 1;
+    argv[0] = JS_NewStringLen(ctx, (const char*)(uintptr_t)pattern_ptr, pattern_len);
+    if (flags_ptr) {
+        argv[1] = JS_NewString(ctx, (const char*)(uintptr_t)flags_ptr);
+        argc = 2;
+    }
+    JSValue re = JS_CallConstructor(ctx, ctor, argc, argv);
+    for (int i = 0; i < argc; i++) JS_FreeValue(ctx, argv[i]);
+    JS_FreeValue(ctx, ctor);
+
+    if (JS_IsException(re)) {
+        JSValue exc = JS_GetException(ctx);  // clear the pending exception
+        JS_FreeValue(ctx, exc);
+        return 0;
+    }
+    JS_FreeValue(ctx, re);
+    return 1;
+}
+
+// Returns cumulative cache hits and misses as two u64s for telemetry.
+__attribute__((export_name("qjs_regexp_cache_stats")))
+void qjs_regexp_cache_stats(uint32_t out_ptr) {
+    if (!out_ptr) return;
+    uint64_t* out = (uint64_t*)(uintptr_t)out_ptr;
+    out[0] = regexp_cache_hits;
+    out[1] = regexp_cache_misses;
+}
+
+// ============================================================================
+// Interrupt Handling
+// ============================================================================
+
+// Set directly by the host through linear memory (see qjs_interrupt_flag_ptr),
+// so arming or clearing a deadline costs no WASM call. The interpreter's own
+// interrupt counter rate-limits how often the handler runs, and the handler
+// itself is a single in-module load — the hot loop never crosses the host
+// boundary.
+static volatile int32_t interrupt_flag = 0;
+
+static void profile_sample(void);
+static JSContext* profile_ctx;
+
+static int bridge_interrupt_handler(JSRuntime* rt, void* opaque) {
+    (void)opaque;
+    if (profile_ctx) profile_sample();
+    watermark_check(rt);
+    return interrupt_flag != 0;
+}
+
+__attribute__((export_name("qjs_install_interrupt_handler")))
+void qjs_install_interrupt_handler(uint32_t rt_ptr) {
+    if (!rt_ptr) return;
+    JSRuntime* rt = (JSRuntime*)(uintptr_t)rt_ptr;
+    JS_SetInterruptHandler(rt, bridge_interrupt_handler, NULL);
+}
+
+// Returns the linear-memory address of the interrupt flag so the host can
+// write it while WASM code is executing.
+__attribute__((export_name("qjs_interrupt_flag_ptr")))
+uint32_t qjs_interrupt_flag_ptr(void) {
+    return (uint32_t)(uintptr_t)&interrupt_flag;
+}
+
+// ============================================================================
+// Sampling Profiler
+// ============================================================================
+//
+// Piggybacks on the interrupt handler, which the interpreter loop invokes
+// every JS_INTERRUPT_COUNTER_INIT opcodes. While profiling is armed, each
+// invocation records the function on top of the JS stack (a self sample)
+// and every distinct function on the stack (a total sample), using the
+// JS_GetCurrentFunctionName accessor added to the engine. Sample counts
+// are proportional to interpreted opcodes, which tracks CPU time closely
+// for bytecode-bound workloads.
+
+#define PROFILE_MAX_FUNCS 256
+#define PROFILE_MAX_DEPTH 32
+
+typedef struct {
+    JSAtom name;  // owned reference, freed on stop
+    uint64_t self;
+    uint64_t total;
+} profile_entry;
+
+static JSContext* profile_ctx = NULL;
+static profile_entry profile_entries[PROFILE_MAX_FUNCS];
+static uint32_t profile_entry_count = 0;
+static uint64_t profile_samples = 0;
+static uint64_t profile_dropped = 0;  // samples lost to a full entry table
+
+static profile_entry* profile_lookup(JSContext* ctx, JSAtom name) {
+    for (uint32_t i = 0; i < profile_entry_count; i++) {
+        if (profile_entries[i].name == name) return &profile_entries[i];
+    }
+    if (profile_entry_count == PROFILE_MAX_FUNCS) return NULL;
+    profile_entry* e = &profile_entries[profile_entry_count++];
+    e->name = JS_DupAtom(ctx, name);
+    e->self = 0;
+    e->total = 0;
+    return e;
+}
+
+static void profile_sample(void) {
+    JSContext* ctx = profile_ctx;
+    JSAtom stack[PROFILE_MAX_DEPTH];
+    int depth = 0;
+
+    profile_samples++;
+    for (; depth < PROFILE_MAX_DEPTH; depth++) {
+        JSAtom name = JS_GetCurrentFunctionName(ctx, depth);
+        if (name == JS_ATOM_NULL) break;  // no frame at this level
+        stack[depth] = name;
+    }
+
+    for (int i = 0; i < depth; i++) {
+        // Count each function once per sample toward total, even when it
+        // appears at several stack levels (recursion).
+        int seen = 0;
+        for (int j = 0; j < i; j++) {
+            if (stack[j] == stack[i]) { seen = 1; break; }
+        }
+        profile_entry* e = profile_lookup(ctx, stack[i]);
+        if (!e) {
+            if (i == 0) profile_dropped++;
+        } else {
+            if (i == 0) e->self++;
+            if (!seen) e->total++;
+        }
+        JS_FreeAtom(ctx, stack[i]);
+    }
+}
+
+static void profile_reset(void) {
+    for (uint32_t i = 0; i < profile_entry_count; i++) {
+        JS_FreeAtom(profile_ctx, profile_entries[i].name);
+    }
+    profile_ctx = NULL;
+    profile_entry_count = 0;
+    profile_samples = 0;
+    profile_dropped = 0;
+}
+
+// Arm the profiler for a context and make sure the interrupt handler that
+// drives sampling is installed. Returns 1 on success, 0 if a profile is
+// already running.
+__attribute__((export_name("qjs_profile_start")))
+int32_t qjs_profile_start(uint32_t ctx_ptr) {
+    if (!ctx_ptr || profile_ctx) return 0;
+    JSContext* ctx = (JSContext*)(uintptr_t)ctx_ptr;
+    JS_SetInterruptHandler(JS_GetRuntime(ctx), bridge_interrupt_handler, NULL);
+    profile_ctx = ctx;
+    return 1;
+}
+
+// Stop sampling and serialize the report into a js_malloc'd buffer (freed
+// with qjs_free_encoded): u64 samples, u64 dropped, u32 entry count, then
+// per entry u32 name length + name bytes, u64 self, u64 total. Returns 0
+// if no profile is running or on allocation failure.
+__attribute__((export_name("qjs_profile_stop")))
+uint32_t qjs_profile_stop(uint32_t out_len_ptr) {
+    if (!profile_ctx || !out_len_ptr) return 0;
+    JSContext* ctx = profile_ctx;
+    marshal_writer w = { ctx, NULL, 0, 0 };
+
+    int ret = marshal_write(&w, &profile_samples, 8) ||
+              marshal_write(&w, &profile_dropped, 8) ||
+              marshal_write(&w, &profile_entry_count, 4);
+    for (uint32_t i = 0; i < profile_entry_count && !ret; i++) {
+        profile_entry* e = &profile_entries[i];
+        const char* name = JS_AtomToCString(ctx, e->name);
+        if (!name) {
+            ret = 1;
+            break;
+        }
+        uint32_t name_len = (uint32_t)strlen(name);
+        ret = marshal_write(&w, &name_len, 4) ||
+              marshal_write(&w, name, name_len) ||
+              marshal_write(&w, &e->self, 8) ||
+              marshal_write(&w, &e->total, 8);
+        JS_FreeCString(ctx, name);
+    }
+    profile_reset();
+
+    if (ret) {
+        js_free(ctx, w.buf);
+        return 0;
+    }
+    *(uint32_t*)(uintptr_t)out_len_ptr = (uint32_t)w.len;
+    return (uint32_t)(uintptr_t)w.buf;
+}
+
 // ============================================================================
 // Utility: Get Error Message
 // ============================================================================
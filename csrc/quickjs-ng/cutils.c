@@ -38,6 +38,9 @@
 #if defined(__APPLE__)
 #include <mach-o/dyld.h>
 #endif
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
 
 #include "cutils.h"
 
@@ -414,8 +417,18 @@ int utf8_scan(const char *buf, size_t buf_len, size_t *plen)
     kind = UTF8_PLAIN_ASCII;
     cbits = 0;
     len = buf_len;
-    // TODO: handle more than 1 byte at a time
-    for (i = 0; i < buf_len; i++)
+    i = 0;
+#if defined(__wasm_simd128__)
+    if (buf_len >= 16) {
+        v128_t acc = wasm_v128_load(buf);
+        for (i = 16; i + 16 <= buf_len; i += 16)
+            acc = wasm_v128_or(acc, wasm_v128_load(buf + i));
+        /* any byte >= 0x80 sets its lane's sign bit */
+        if (wasm_i8x16_bitmask(acc))
+            cbits = 0x80;
+    }
+#endif
+    for (; i < buf_len; i++)
         cbits |= buf[i];
     if (cbits >= 0x80) {
         p = (const uint8_t *)buf;
@@ -487,7 +500,20 @@ size_t utf8_decode_buf16(uint16_t *dest, size_t dest_len, const char *src, size_
 
     p = (const uint8_t *)src;
     p_end = p + src_len;
-    for (i = 0; p < p_end; i++) {
+    i = 0;
+#if defined(__wasm_simd128__)
+    /* widen runs of 16 ASCII bytes to 16-bit code units at once */
+    while (p + 16 <= p_end && i + 16 <= dest_len) {
+        v128_t v = wasm_v128_load(p);
+        if (wasm_i8x16_bitmask(v))
+            break;
+        wasm_v128_store(dest + i, wasm_u16x8_extend_low_u8x16(v));
+        wasm_v128_store(dest + i + 8, wasm_u16x8_extend_high_u8x16(v));
+        p += 16;
+        i += 16;
+    }
+#endif
+    for (; p < p_end; i++) {
         uint32_t c = *p++;
         if (c >= 0x80) {
             /* parse utf-8 sequence */
@@ -555,7 +581,19 @@ size_t utf8_encode_buf16(char *dest, size_t dest_len, const uint16_t *src, size_
     size_t i, j;
     uint32_t c;
 
-    for (i = j = 0; i < src_len;) {
+    i = j = 0;
+#if defined(__wasm_simd128__)
+    /* narrow runs of 8 ASCII code units to bytes at once */
+    while (i + 8 <= src_len && j + 8 < dest_len) {
+        v128_t v = wasm_v128_load(src + i);
+        if (wasm_v128_any_true(wasm_v128_and(v, wasm_i16x8_splat((int16_t)0xFF80))))
+            break;
+        wasm_v128_store64_lane(dest + j, wasm_u8x16_narrow_i16x8(v, v), 0);
+        i += 8;
+        j += 8;
+    }
+#endif
+    while (i < src_len) {
         c = src[i++];
         if (c < 0x80) {
             if (j + 1 >= dest_len)
@@ -1981,6 +1981,10 @@ size_t JS_GetGCThreshold(JSRuntime *rt) {
     return rt->malloc_gc_threshold;
 }
 
+size_t JS_GetMallocSize(JSRuntime *rt) {
+    return rt->malloc_state.malloc_size;
+}
+
 /* use -1 to disable automatic GC */
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold)
 {
@@ -28862,6 +28866,35 @@ JSAtom JS_GetScriptOrModuleName(JSContext *ctx, int n_stack_levels)
     return JS_DupAtom(ctx, b->filename);
 }
 
+/* Return the name of the function executing n_stack_levels up the current
+   stack, for sampling profilers. Returns JS_ATOM_NULL only when no stack
+   frame exists at that level; frames without a usable name (C functions,
+   anonymous functions, stripped bytecode) yield the empty string atom so
+   callers can keep walking past them. */
+JSAtom JS_GetCurrentFunctionName(JSContext *ctx, int n_stack_levels)
+{
+    JSStackFrame *sf;
+    JSFunctionBytecode *b;
+    JSObject *p;
+    sf = ctx->rt->current_stack_frame;
+    if (!sf)
+        return JS_ATOM_NULL;
+    while (n_stack_levels-- > 0) {
+        sf = sf->prev_frame;
+        if (!sf)
+            return JS_ATOM_NULL;
+    }
+    if (JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT)
+        return JS_DupAtom(ctx, JS_ATOM_empty_string);
+    p = JS_VALUE_GET_OBJ(sf->cur_func);
+    if (!js_class_has_bytecode(p->class_id))
+        return JS_DupAtom(ctx, JS_ATOM_empty_string);
+    b = p->u.func.function_bytecode;
+    if (b->func_name == JS_ATOM_NULL)
+        return JS_DupAtom(ctx, JS_ATOM_empty_string);
+    return JS_DupAtom(ctx, b->func_name);
+}
+
 JSAtom JS_GetModuleName(JSContext *ctx, JSModuleDef *m)
 {
     return JS_DupAtom(ctx, m->module_name);
@@ -45417,6 +45450,16 @@ static void js_regexp_finalizer(JSRuntime *rt, JSValueConst val)
 }
 
 /* create a string containing the RegExp bytecode */
+#ifdef QJS_BRIDGE_REGEXP_CACHE
+/* Process-wide compiled-regex cache managed by the embedder (bridge.c).
+   Compiled patterns normally die with their context; the cache lets the
+   same patterns amortize compilation across many short-lived contexts. */
+const uint8_t *qjs_regexp_cache_lookup(const char *pattern, size_t pattern_len,
+                                       int re_flags, int *out_len);
+void qjs_regexp_cache_store(const char *pattern, size_t pattern_len,
+                            int re_flags, const uint8_t *bc, int bc_len);
+#endif
+
 static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags)
 {
@@ -45480,8 +45523,25 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
     str = JS_ToCStringLen2(ctx, &len, pattern, !(re_flags & LRE_FLAG_UNICODE));
     if (!str)
         return JS_EXCEPTION;
+#ifdef QJS_BRIDGE_REGEXP_CACHE
+    {
+        int cached_len;
+        const uint8_t *cached = qjs_regexp_cache_lookup(str, len, re_flags,
+                                                        &cached_len);
+        if (cached) {
+            ret = js_new_string8_len(ctx, (const char *)cached, cached_len);
+            JS_FreeCString(ctx, str);
+            return ret;
+        }
+    }
+#endif
     re_bytecode_buf = lre_compile(&re_bytecode_len, error_msg,
                                   sizeof(error_msg), str, len, re_flags, ctx);
+#ifdef QJS_BRIDGE_REGEXP_CACHE
+    if (re_bytecode_buf)
+        qjs_regexp_cache_store(str, len, re_flags, re_bytecode_buf,
+                               re_bytecode_len);
+#endif
     JS_FreeCString(ctx, str);
     if (!re_bytecode_buf) {
         JS_ThrowSyntaxError(ctx, "%s", error_msg);
@@ -0,0 +1,240 @@
+package quickjs
+
+import (
+	"container/heap"
+	"context"
+	"errors"
+	"sync"
+	"time"
+)
+
+// eventLoop is the Go side of the timer natives installed by
+// Context.EnableTimers. setTimeout and friends never see an engine-side
+// clock: they hand the callback's slot handle to schedule (called from
+// inside WASM while the runtime lock is held), and Serve fires handles back
+// through the ordinary call path when deadlines pass. Between deadlines the
+// loop sleeps on a timer, so idle timer workloads cost zero CPU.
+type eventLoop struct {
+	rt *Runtime
+
+	mu     sync.Mutex
+	heap   timerHeap
+	timers map[uint32]*timerEntry // live (non-canceled) timers by id
+	nextID uint32
+	wake   chan struct{}
+}
+
+type timerEntry struct {
+	id       uint32
+	ctxPtr   uint32
+	fnHandle uint32
+	when     time.Time
+	period   time.Duration // 0 for one-shot
+	canceled bool
+	index    int // heap position
+}
+
+type timerHeap []*timerEntry
+
+func (h timerHeap) Len() int           { return len(h) }
+func (h timerHeap) Less(i, j int) bool { return h[i].when.Before(h[j].when) }
+func (h timerHeap) Swap(i, j int)      { h[i], h[j] = h[j], h[i]; h[i].index = i; h[j].index = j }
+func (h *timerHeap) Push(x any)        { e := x.(*timerEntry); e.index = len(*h); *h = append(*h, e) }
+func (h *timerHeap) Pop() any          { old := *h; n := len(old); e := old[n-1]; *h = old[:n-1]; return e }
+func (h timerHeap) peek() *timerEntry  { return h[0] }
+
+// EnableTimers installs setTimeout/setInterval/clearTimeout/clearInterval/
+// queueMicrotask on the context's global object. Scheduled callbacks only
+// fire while Runtime.Serve is running.
+func (c *Context) EnableTimers() error {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+	return c.runtime.bridge.AddTimers(c.runtime.goCtx, c.ctxPtr)
+}
+
+// Serve drives timers and pending jobs for the runtime until ctx is
+// canceled. It sleeps until the earliest deadline (or a schedule change)
+// and wakes precisely, firing due callbacks and draining the job queue
+// after each one; a callback that throws is swallowed like a browser timer
+// rather than stopping the loop. Only one Serve may run per runtime.
+// Returns ctx.Err() on cancellation.
+func (r *Runtime) Serve(ctx context.Context) error {
+	l := &eventLoop{
+		rt:     r,
+		timers: make(map[uint32]*timerEntry),
+		wake:   make(chan struct{}, 1),
+	}
+
+	r.loopMu.Lock()
+	if r.loop != nil {
+		r.loopMu.Unlock()
+		return errors.New("Serve is already running on this runtime")
+	}
+	r.loop = l
+	r.loopMu.Unlock()
+
+	r.bridge.SetTimerHost(l.schedule, l.cancel)
+	defer func() {
+		r.bridge.SetTimerHost(nil, nil)
+		r.loopMu.Lock()
+		r.loop = nil
+		r.loopMu.Unlock()
+		l.releaseAll()
+	}()
+
+	for {
+		due, stale := l.collect()
+		for _, e := range stale {
+			r.freeTimerHandle(e)
+		}
+		for _, e := range due {
+			r.fireTimer(e)
+		}
+		// Microtasks enqueued outside a timer callback (queueMicrotask
+		// sends a bare wakeup) are drained here.
+		_, _ = r.ExecutePendingJobs()
+		if len(due) > 0 {
+			continue // deadlines may have passed while firing
+		}
+
+		var timer *time.Timer
+		var timerC <-chan time.Time
+		l.mu.Lock()
+		if len(l.heap) > 0 {
+			timer = time.NewTimer(time.Until(l.heap.peek().when))
+			timerC = timer.C
+		}
+		l.mu.Unlock()
+
+		select {
+		case <-ctx.Done():
+			if timer != nil {
+				timer.Stop()
+			}
+			return ctx.Err()
+		case <-l.wake:
+			if timer != nil {
+				timer.Stop()
+			}
+		case <-timerC:
+		}
+	}
+}
+
+// schedule is the host_timer_schedule hook. It runs on the goroutine
+// executing WASM (runtime lock held), so it only touches loop state and
+// never calls back into the engine. fnHandle 0 is a bare wakeup.
+func (l *eventLoop) schedule(ctxPtr, fnHandle uint32, delayMs float64, repeat bool) uint32 {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
+	l.nextID++
+	if l.nextID == 0 {
+		l.nextID = 1
+	}
+	if fnHandle != 0 {
+		e := &timerEntry{
+			id:       l.nextID,
+			ctxPtr:   ctxPtr,
+			fnHandle: fnHandle,
+			when:     time.Now().Add(time.Duration(delayMs * float64(time.Millisecond))),
+		}
+		if repeat {
+			e.period = time.Duration(delayMs * float64(time.Millisecond))
+			if e.period <= 0 {
+				e.period = time.Millisecond
+			}
+		}
+		l.timers[e.id] = e
+		heap.Push(&l.heap, e)
+	}
+
+	select {
+	case l.wake <- struct{}{}:
+	default:
+	}
+	return l.nextID
+}
+
+// cancel is the host_timer_cancel hook. Deletion is lazy: the entry stays
+// in the heap until Serve pops it and frees the callback's slot.
+func (l *eventLoop) cancel(id uint32) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	if e, ok := l.timers[id]; ok {
+		e.canceled = true
+		delete(l.timers, id)
+	}
+}
+
+// collect pops every due and every canceled timer off the heap, rearming
+// intervals. Due entries are returned for firing, canceled ones for slot
+// release.
+func (l *eventLoop) collect() (due, stale []*timerEntry) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
+	now := time.Now()
+	for len(l.heap) > 0 {
+		e := l.heap.peek()
+		if e.canceled {
+			heap.Pop(&l.heap)
+			stale = append(stale, e)
+			continue
+		}
+		if e.when.After(now) {
+			break
+		}
+		heap.Pop(&l.heap)
+		due = append(due, e)
+		if e.period > 0 {
+			e.when = now.Add(e.period)
+			heap.Push(&l.heap, e)
+		} else {
+			delete(l.timers, e.id)
+		}
+	}
+	return due, stale
+}
+
+// fireTimer calls a due timer's callback and drains any microtasks it
+// enqueued. Exceptions are consumed so one broken callback cannot wedge
+// the loop.
+func (r *Runtime) fireTimer(e *timerEntry) {
+	r.lock()
+	defer r.unlock()
+
+	resPtr, err := r.bridge.Call(r.goCtx, e.ctxPtr, e.fnHandle, 0, nil)
+	if err == nil {
+		if isExc, _ := r.bridge.IsException(r.goCtx, resPtr); isExc {
+			excPtr, _ := r.bridge.GetException(r.goCtx, e.ctxPtr)
+			_ = r.bridge.FreeValue(r.goCtx, e.ctxPtr, excPtr)
+		} else {
+			_ = r.bridge.FreeValue(r.goCtx, e.ctxPtr, resPtr)
+		}
+	}
+	if e.period == 0 {
+		_ = r.bridge.FreeValue(r.goCtx, e.ctxPtr, e.fnHandle)
+	}
+	_, _ = r.bridge.ExecutePendingJobs(r.goCtx, r.rtPtr)
+}
+
+func (r *Runtime) freeTimerHandle(e *timerEntry) {
+	r.lock()
+	defer r.unlock()
+	_ = r.bridge.FreeValue(r.goCtx, e.ctxPtr, e.fnHandle)
+}
+
+// releaseAll frees the callback slots of every timer still pending when
+// Serve stops.
+func (l *eventLoop) releaseAll() {
+	l.mu.Lock()
+	entries := l.heap
+	l.heap = nil
+	l.timers = make(map[uint32]*timerEntry)
+	l.mu.Unlock()
+
+	for _, e := range entries {
+		l.rt.freeTimerHandle(e)
+	}
+}
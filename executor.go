@@ -0,0 +1,125 @@
+package quickjs
+
+import (
+	"errors"
+	"fmt"
+	"runtime"
+	"sync"
+)
+
+// Executor runs JavaScript jobs across a pool of worker goroutines, each
+// owning a fully independent runtime (its own WASM instance and context).
+// A single Runtime serializes everything behind its mutex because WASM
+// execution is not thread-safe, so no amount of goroutines gets past one
+// core; separate instances share only the read-only compiled module (via
+// the global compilation cache) and execute truly in parallel. Jobs go
+// into one shared queue that every idle worker pulls from, so work
+// submitted while some workers are busy is immediately claimed by whichever
+// worker frees up first.
+//
+// Usage:
+//
+//	ex, err := quickjs.NewExecutor(runtime.NumCPU())
+//	...
+//	result, err := ex.Eval("1 + 2")
+type Executor struct {
+	jobs   chan executorJob
+	wg     sync.WaitGroup
+	mu     sync.Mutex
+	closed bool
+}
+
+type executorJob struct {
+	fn   func(*Context) error
+	done chan error
+}
+
+// NewExecutor creates an executor with the given number of workers.
+// workers <= 0 means one worker per CPU.
+func NewExecutor(workers int) (*Executor, error) {
+	if workers <= 0 {
+		workers = runtime.NumCPU()
+	}
+
+	e := &Executor{jobs: make(chan executorJob)}
+	runtimes := make([]*Runtime, 0, workers)
+	contexts := make([]*Context, 0, workers)
+	for i := 0; i < workers; i++ {
+		rt, err := NewRuntime()
+		if err == nil {
+			var ctx *Context
+			if ctx, err = rt.NewContext(); err == nil {
+				runtimes = append(runtimes, rt)
+				contexts = append(contexts, ctx)
+				continue
+			}
+			rt.Close()
+		}
+		for j := range runtimes {
+			contexts[j].Close()
+			runtimes[j].Close()
+		}
+		return nil, fmt.Errorf("failed to start executor worker: %w", err)
+	}
+
+	for i := 0; i < workers; i++ {
+		e.wg.Add(1)
+		go e.worker(runtimes[i], contexts[i])
+	}
+	return e, nil
+}
+
+func (e *Executor) worker(rt *Runtime, ctx *Context) {
+	defer e.wg.Done()
+	for job := range e.jobs {
+		job.done <- job.fn(ctx)
+	}
+	ctx.Close()
+	rt.Close()
+}
+
+// Do runs fn on an idle worker's context and blocks until it returns. The
+// context (and any Value derived from it) is owned by that worker and must
+// not escape fn.
+func (e *Executor) Do(fn func(*Context) error) error {
+	job := executorJob{fn: fn, done: make(chan error, 1)}
+
+	e.mu.Lock()
+	if e.closed {
+		e.mu.Unlock()
+		return errors.New("executor is closed")
+	}
+	e.jobs <- job
+	e.mu.Unlock()
+
+	return <-job.done
+}
+
+// Eval runs code on an idle worker and returns the result decoded into Go
+// (bool, int64, float64, string, []any, map[string]any or nil).
+func (e *Executor) Eval(code string) (any, error) {
+	var out any
+	err := e.Do(func(ctx *Context) error {
+		val, err := ctx.Eval(code)
+		if err != nil {
+			return err
+		}
+		return val.Unmarshal(&out)
+	})
+	return out, err
+}
+
+// Close shuts down all workers and their runtimes, waiting for in-flight
+// jobs to finish.
+func (e *Executor) Close() {
+	e.mu.Lock()
+	if e.closed {
+		e.mu.Unlock()
+		return
+	}
+	e.closed = true
+	close(e.jobs)
+	e.mu.Unlock()
+
+	e.wg.Wait()
+}
@@ -7,8 +7,10 @@ import (
 	"encoding/binary"
 	"errors"
 	"fmt"
+	"io"
 	"math"
 	"sync"
+	"sync/atomic"
 
 	"github.com/tetratelabs/wazero"
 	"github.com/tetratelabs/wazero/api"
@@ -29,6 +31,53 @@ func initGlobalCache() {
 	globalCache = wazero.NewCompilationCache()
 }
 
+// SetCompilationCacheDir switches the global compilation cache to a
+// filesystem-backed cache at dir and pre-compiles the embedded module into
+// it. With the cache on disk, restarted processes load the compiled machine
+// code instead of re-JITting the WASM binary. Must be called before the
+// first Bridge is created.
+func SetCompilationCacheDir(ctx context.Context, dir string) error {
+	cache, err := wazero.NewCompilationCacheWithDir(dir)
+	if err != nil {
+		return fmt.Errorf("failed to open compilation cache dir: %w", err)
+	}
+
+	installed := false
+	globalCacheOnce.Do(func() {
+		globalCache = cache
+		installed = true
+	})
+	if !installed {
+		return errors.New("compilation cache already initialized; set the cache dir before creating any runtime")
+	}
+
+	// Pre-warm: compiling the embedded module now populates the on-disk
+	// cache, so even this process's first runtime skips compilation.
+	runtimeConfig := wazero.NewRuntimeConfig().
+		WithCompilationCache(cache).
+		WithDebugInfoEnabled(false)
+	r := wazero.NewRuntimeWithConfig(ctx, runtimeConfig)
+	defer r.Close(ctx)
+	if _, err := compileEmbeddedModule(ctx, r); err != nil {
+		return fmt.Errorf("failed to pre-compile WASM module: %w", err)
+	}
+	return nil
+}
+
+// compileEmbeddedModule compiles the embedded QuickJS binary, preferring the
+// SIMD-enabled build when one is embedded (quickjs_simd build tag, see
+// wasm/embed_simd.go). Compilation is the feature check: wazero rejects v128
+// opcodes on hosts without SIMD support, in which case the scalar binary is
+// compiled instead.
+func compileEmbeddedModule(ctx context.Context, r wazero.Runtime) (wazero.CompiledModule, error) {
+	if len(wasm.QuickJSSIMD) > 0 {
+		if compiled, err := r.CompileModule(ctx, wasm.QuickJSSIMD); err == nil {
+			return compiled, nil
+		}
+	}
+	return r.CompileModule(ctx, wasm.QuickJS)
+}
+
 // Buffer pool to reduce allocations for small temporary buffers
 var bufPool = sync.Pool{
 	New: func() any {
@@ -50,6 +99,17 @@ func putBuffer(buf *[]byte) {
 // It receives the context pointer and the arguments as JSValue pointers.
 type GoFunc func(ctxPtr uint32, args []uint32) uint32
 
+// GoFuncPrim is the eager-marshal callback variant: args holds the batched
+// argument buffer (u32 count + encoded values in the marshal wire format)
+// and the returned buffer encodes the result the same way (nil or empty for
+// undefined). The args slice is a view into WASM memory valid only for the
+// duration of the call.
+type GoFuncPrim func(ctxPtr uint32, args []byte) []byte
+
+// primRespOverflow tells the C side the encoded result did not fit in its
+// response buffer. Matches PRIM_RESPONSE_OVERFLOW in csrc/bridge.c.
+const primRespOverflow = 0xFFFFFFFF
+
 // Bridge manages the WASM runtime and provides low-level access to QuickJS-ng functions.
 type Bridge struct {
 	wasmRuntime wazero.Runtime
@@ -58,10 +118,36 @@ type Bridge struct {
 	mu          sync.Mutex
 	logFunc     func(msg string)
 
-	// Go function callbacks
-	callbacks  map[uint32]GoFunc // funcID -> Go function
-	nextFuncID uint32
-	callbackMu sync.RWMutex
+	// Go function callbacks. Regular and eager-marshal callbacks share the
+	// funcID space but live in separate maps so dispatch needs no type switch.
+	callbacks     map[uint32]GoFunc     // funcID -> Go function
+	primCallbacks map[uint32]GoFuncPrim // funcID -> eager-marshal Go function
+	nextFuncID    uint32
+	callbackMu    sync.RWMutex
+
+	// Module loading: resolver supplied by the host and a bytecode cache
+	// keyed by specifier, filled by host_store_module so each module is
+	// parsed once per bridge rather than once per context. Both are
+	// accessed only under the runtime lock.
+	moduleLoader func(specifier string) (string, error)
+	moduleCache  map[string][]byte
+
+	// Timer host hooks for setTimeout and friends, installed by the event
+	// loop (Runtime.Serve). Guarded by timerMu because the schedule hook is
+	// called from inside WASM execution while the runtime lock is held.
+	timerMu       sync.Mutex
+	timerSchedule func(ctxPtr, fnHandle uint32, delayMs float64, repeat bool) uint32
+	timerCancel   func(id uint32)
+
+	// Soft memory watermark hook, fired by the engine's interrupt handler
+	// when the malloc counter crosses the armed watermark. Guarded by
+	// timerMu like the other mid-execution hooks.
+	watermarkFunc func(rtPtr uint32, usedBytes uint64)
+
+	// Trace mode (see trace.go). traceStats is populated once during
+	// initFunctions and read-only afterwards.
+	traceEnabled atomic.Bool
+	traceStats   map[string]*funcStats
 
 	// Exported functions from WASM
 	fnAlloc               api.Function
@@ -69,13 +155,27 @@ type Bridge struct {
 	fnGetHeapPtr          api.Function
 	fnGetHeapSize         api.Function
 	fnResetHeap           api.Function
+	fnResetSlots          api.Function
 	fnNewRuntime          api.Function
 	fnFreeRuntime         api.Function
 	fnNewContext          api.Function
 	fnFreeContext         api.Function
+	fnContextBaseline     api.Function
+	fnContextReset        api.Function
 	fnGetRuntime          api.Function
 	fnEval                api.Function
+	fnEvalPrim            api.Function
 	fnEvalModule          api.Function
+	fnEvalBegin           api.Function
+	fnEvalChunk           api.Function
+	fnEvalFinish          api.Function
+	fnEvalAbort           api.Function
+	fnCompile             api.Function
+	fnFreeBytecode        api.Function
+	fnEvalBytecode        api.Function
+	fnCloneWrite          api.Function
+	fnCloneRead           api.Function
+	fnEnableModuleLoader  api.Function
 	fnIsException         api.Function
 	fnIsUndefined         api.Function
 	fnIsNull              api.Function
@@ -112,11 +212,18 @@ type Bridge struct {
 	fnGetProperty         api.Function
 	fnSetProperty         api.Function
 	fnHasProperty         api.Function
+	fnNewAtom             api.Function
+	fnFreeAtom            api.Function
+	fnGetPropertyAtom     api.Function
+	fnSetPropertyAtom     api.Function
 	fnDeleteProperty      api.Function
+	fnGetProperties       api.Function
+	fnSetProperties       api.Function
 	fnGetPropertyUint32   api.Function
 	fnSetPropertyUint32   api.Function
 	fnGetGlobalObject     api.Function
 	fnCall                api.Function
+	fnCallPrim            api.Function
 	fnCallConstructor     api.Function
 	fnInvoke              api.Function
 	fnGetException        api.Function
@@ -131,10 +238,18 @@ type Bridge struct {
 	fnFreeValue           api.Function
 	fnJSONParse           api.Function
 	fnJSONStringify       api.Function
+	fnJSONStringifyLen    api.Function
+	fnStaleHandleCount    api.Function
+	fnSlotStats           api.Function
+	fnArenaStats          api.Function
 	fnRunGC               api.Function
+	fnComputeMemoryUsage  api.Function
 	fnIsPromise           api.Function
 	fnNewPromise          api.Function
 	fnExecutePendingJobs  api.Function
+	fnExecutePendingJob   api.Function
+	fnPromiseState        api.Function
+	fnPromiseResult       api.Function
 	fnNewBigInt64         api.Function
 	fnNewBigUint64        api.Function
 	fnToBigInt64          api.Function
@@ -144,11 +259,32 @@ type Bridge struct {
 	fnGetOwnPropertyNames api.Function
 	fnNewArrayBuffer      api.Function
 	fnGetArrayBuffer      api.Function
+	fnNewUninitArrayBuf   api.Function
+	fnNewTypedArray       api.Function
+	fnGetTypedArrayInfo   api.Function
+	fnBuildValue          api.Function
+	fnEncodeValue         api.Function
+	fnFreeEncoded         api.Function
+	fnOwnProperties       api.Function
 	fnStdAddConsole       api.Function
+	fnAddTimers           api.Function
 	fnNewCFunction        api.Function
+	fnNewCFunctionPrim    api.Function
+	fnChannelInit         api.Function
+	fnChannelClose        api.Function
+	fnChannelLayout       api.Function
+	fnChannelPoll         api.Function
 	fnStrictEq            api.Function
 	fnSetMemoryLimit      api.Function
 	fnSetMaxStackSize     api.Function
+	fnSetGCThreshold      api.Function
+	fnSetMemoryWatermark  api.Function
+	fnInstallInterrupt    api.Function
+	fnInterruptFlagPtr    api.Function
+	fnProfileStart        api.Function
+	fnProfileStop         api.Function
+	fnPrecompileRegexp    api.Function
+	fnRegexpCacheStats    api.Function
 	fnGetErrorMessage     api.Function
 	fnGetErrorStack       api.Function
 	fnToString            api.Function
@@ -160,8 +296,10 @@ func New(ctx context.Context) (*Bridge, error) {
 		logFunc: func(msg string) {
 			fmt.Print(msg)
 		},
-		callbacks:  make(map[uint32]GoFunc),
-		nextFuncID: 1,
+		callbacks:     make(map[uint32]GoFunc),
+		primCallbacks: make(map[uint32]GoFuncPrim),
+		nextFuncID:    1,
+		moduleCache:   make(map[string][]byte),
 	}
 
 	// Initialize global compilation cache once
@@ -187,13 +325,31 @@ func New(ctx context.Context) (*Bridge, error) {
 		NewFunctionBuilder().
 		WithFunc(b.hostCallGo).
 		Export("host_call_go").
+		NewFunctionBuilder().
+		WithFunc(b.hostCallGoPrim).
+		Export("host_call_go_prim").
+		NewFunctionBuilder().
+		WithFunc(b.hostLoadModule).
+		Export("host_load_module").
+		NewFunctionBuilder().
+		WithFunc(b.hostStoreModule).
+		Export("host_store_module").
+		NewFunctionBuilder().
+		WithFunc(b.hostTimerSchedule).
+		Export("host_timer_schedule").
+		NewFunctionBuilder().
+		WithFunc(b.hostTimerCancel).
+		Export("host_timer_cancel").
+		NewFunctionBuilder().
+		WithFunc(b.hostMemoryWatermark).
+		Export("host_memory_watermark").
 		Instantiate(ctx)
 	if err != nil {
 		return nil, fmt.Errorf("failed to instantiate host module: %w", err)
 	}
 
 	// Compile the WASM module - the compilation cache makes subsequent compiles fast
-	compiled, err := b.wasmRuntime.CompileModule(ctx, wasm.QuickJS)
+	compiled, err := compileEmbeddedModule(ctx, b.wasmRuntime)
 	if err != nil {
 		return nil, fmt.Errorf("failed to compile WASM module: %w", err)
 	}
@@ -222,7 +378,9 @@ func (b *Bridge) initFunctions() error {
 		if fn == nil {
 			return nil, fmt.Errorf("function %s not found in WASM module", name)
 		}
-		return fn, nil
+		// Every export goes through the trace decorator; with tracing off
+		// it costs one atomic load per call.
+		return b.traceWrap(name, fn), nil
 	}
 
 	var err error
@@ -243,6 +401,18 @@ func (b *Bridge) initFunctions() error {
 	if b.fnResetHeap, err = getFn("qjs_reset_heap"); err != nil {
 		return err
 	}
+	if b.fnResetSlots, err = getFn("qjs_reset_slots"); err != nil {
+		return err
+	}
+	if b.fnStaleHandleCount, err = getFn("qjs_stale_handle_count"); err != nil {
+		return err
+	}
+	if b.fnSlotStats, err = getFn("qjs_slot_stats"); err != nil {
+		return err
+	}
+	if b.fnArenaStats, err = getFn("qjs_arena_stats"); err != nil {
+		return err
+	}
 
 	// Runtime and context
 	if b.fnNewRuntime, err = getFn("qjs_new_runtime"); err != nil {
@@ -257,6 +427,12 @@ func (b *Bridge) initFunctions() error {
 	if b.fnFreeContext, err = getFn("qjs_free_context"); err != nil {
 		return err
 	}
+	if b.fnContextBaseline, err = getFn("qjs_context_baseline"); err != nil {
+		return err
+	}
+	if b.fnContextReset, err = getFn("qjs_context_reset"); err != nil {
+		return err
+	}
 	if b.fnGetRuntime, err = getFn("qjs_get_runtime"); err != nil {
 		return err
 	}
@@ -265,9 +441,42 @@ func (b *Bridge) initFunctions() error {
 	if b.fnEval, err = getFn("qjs_eval"); err != nil {
 		return err
 	}
+	if b.fnEvalPrim, err = getFn("qjs_eval_prim"); err != nil {
+		return err
+	}
+	if b.fnEvalBegin, err = getFn("qjs_eval_begin"); err != nil {
+		return err
+	}
+	if b.fnEvalChunk, err = getFn("qjs_eval_chunk"); err != nil {
+		return err
+	}
+	if b.fnEvalFinish, err = getFn("qjs_eval_finish"); err != nil {
+		return err
+	}
+	if b.fnEvalAbort, err = getFn("qjs_eval_abort"); err != nil {
+		return err
+	}
 	if b.fnEvalModule, err = getFn("qjs_eval_module"); err != nil {
 		return err
 	}
+	if b.fnCompile, err = getFn("qjs_compile"); err != nil {
+		return err
+	}
+	if b.fnFreeBytecode, err = getFn("qjs_free_bytecode"); err != nil {
+		return err
+	}
+	if b.fnCloneWrite, err = getFn("qjs_clone_write"); err != nil {
+		return err
+	}
+	if b.fnCloneRead, err = getFn("qjs_clone_read"); err != nil {
+		return err
+	}
+	if b.fnEvalBytecode, err = getFn("qjs_eval_bytecode"); err != nil {
+		return err
+	}
+	if b.fnEnableModuleLoader, err = getFn("qjs_enable_module_loader"); err != nil {
+		return err
+	}
 
 	// Type checking
 	if b.fnIsException, err = getFn("qjs_is_exception"); err != nil {
@@ -384,9 +593,27 @@ func (b *Bridge) initFunctions() error {
 	if b.fnHasProperty, err = getFn("qjs_has_property"); err != nil {
 		return err
 	}
+	if b.fnNewAtom, err = getFn("qjs_new_atom"); err != nil {
+		return err
+	}
+	if b.fnFreeAtom, err = getFn("qjs_free_atom"); err != nil {
+		return err
+	}
+	if b.fnGetPropertyAtom, err = getFn("qjs_get_property_atom"); err != nil {
+		return err
+	}
+	if b.fnSetPropertyAtom, err = getFn("qjs_set_property_atom"); err != nil {
+		return err
+	}
 	if b.fnDeleteProperty, err = getFn("qjs_delete_property"); err != nil {
 		return err
 	}
+	if b.fnGetProperties, err = getFn("qjs_get_properties"); err != nil {
+		return err
+	}
+	if b.fnSetProperties, err = getFn("qjs_set_properties"); err != nil {
+		return err
+	}
 	if b.fnGetPropertyUint32, err = getFn("qjs_get_property_uint32"); err != nil {
 		return err
 	}
@@ -401,6 +628,9 @@ func (b *Bridge) initFunctions() error {
 	if b.fnCall, err = getFn("qjs_call"); err != nil {
 		return err
 	}
+	if b.fnCallPrim, err = getFn("qjs_call_prim"); err != nil {
+		return err
+	}
 	if b.fnCallConstructor, err = getFn("qjs_call_constructor"); err != nil {
 		return err
 	}
@@ -449,11 +679,17 @@ func (b *Bridge) initFunctions() error {
 	if b.fnJSONStringify, err = getFn("qjs_json_stringify"); err != nil {
 		return err
 	}
+	if b.fnJSONStringifyLen, err = getFn("qjs_json_stringify_len"); err != nil {
+		return err
+	}
 
 	// GC
 	if b.fnRunGC, err = getFn("qjs_run_gc"); err != nil {
 		return err
 	}
+	if b.fnComputeMemoryUsage, err = getFn("qjs_compute_memory_usage"); err != nil {
+		return err
+	}
 
 	// Promise
 	if b.fnIsPromise, err = getFn("qjs_is_promise"); err != nil {
@@ -465,6 +701,15 @@ func (b *Bridge) initFunctions() error {
 	if b.fnExecutePendingJobs, err = getFn("qjs_execute_pending_jobs"); err != nil {
 		return err
 	}
+	if b.fnExecutePendingJob, err = getFn("qjs_execute_pending_job"); err != nil {
+		return err
+	}
+	if b.fnPromiseState, err = getFn("qjs_promise_state"); err != nil {
+		return err
+	}
+	if b.fnPromiseResult, err = getFn("qjs_promise_result"); err != nil {
+		return err
+	}
 
 	// BigInt
 	if b.fnNewBigInt64, err = getFn("qjs_new_big_int64"); err != nil {
@@ -502,16 +747,59 @@ func (b *Bridge) initFunctions() error {
 	if b.fnGetArrayBuffer, err = getFn("qjs_get_array_buffer"); err != nil {
 		return err
 	}
+	if b.fnNewUninitArrayBuf, err = getFn("qjs_new_uninit_array_buffer"); err != nil {
+		return err
+	}
+	if b.fnNewTypedArray, err = getFn("qjs_new_typed_array"); err != nil {
+		return err
+	}
+	if b.fnGetTypedArrayInfo, err = getFn("qjs_get_typed_array_info"); err != nil {
+		return err
+	}
+
+	// Struct marshaling
+	if b.fnBuildValue, err = getFn("qjs_build_value"); err != nil {
+		return err
+	}
+	if b.fnEncodeValue, err = getFn("qjs_encode_value"); err != nil {
+		return err
+	}
+	if b.fnFreeEncoded, err = getFn("qjs_free_encoded"); err != nil {
+		return err
+	}
+	if b.fnOwnProperties, err = getFn("qjs_own_properties"); err != nil {
+		return err
+	}
 
 	// Console
 	if b.fnStdAddConsole, err = getFn("qjs_std_add_console"); err != nil {
 		return err
 	}
+	if b.fnAddTimers, err = getFn("qjs_add_timers"); err != nil {
+		return err
+	}
 
 	// C function binding
 	if b.fnNewCFunction, err = getFn("qjs_new_c_function"); err != nil {
 		return err
 	}
+	if b.fnNewCFunctionPrim, err = getFn("qjs_new_c_function_prim"); err != nil {
+		return err
+	}
+
+	// Channel
+	if b.fnChannelInit, err = getFn("qjs_channel_init"); err != nil {
+		return err
+	}
+	if b.fnChannelClose, err = getFn("qjs_channel_close"); err != nil {
+		return err
+	}
+	if b.fnChannelLayout, err = getFn("qjs_channel_layout"); err != nil {
+		return err
+	}
+	if b.fnChannelPoll, err = getFn("qjs_channel_poll"); err != nil {
+		return err
+	}
 
 	// Equality
 	if b.fnStrictEq, err = getFn("qjs_strict_eq"); err != nil {
@@ -525,6 +813,34 @@ func (b *Bridge) initFunctions() error {
 	if b.fnSetMaxStackSize, err = getFn("qjs_set_max_stack_size"); err != nil {
 		return err
 	}
+	if b.fnSetGCThreshold, err = getFn("qjs_set_gc_threshold"); err != nil {
+		return err
+	}
+	if b.fnSetMemoryWatermark, err = getFn("qjs_set_memory_watermark"); err != nil {
+		return err
+	}
+	if b.fnInstallInterrupt, err = getFn("qjs_install_interrupt_handler"); err != nil {
+		return err
+	}
+	if b.fnInterruptFlagPtr, err = getFn("qjs_interrupt_flag_ptr"); err != nil {
+		return err
+	}
+
+	// Profiling
+	if b.fnProfileStart, err = getFn("qjs_profile_start"); err != nil {
+		return err
+	}
+	if b.fnProfileStop, err = getFn("qjs_profile_stop"); err != nil {
+		return err
+	}
+
+	// Regex cache
+	if b.fnPrecompileRegexp, err = getFn("qjs_precompile_regexp"); err != nil {
+		return err
+	}
+	if b.fnRegexpCacheStats, err = getFn("qjs_regexp_cache_stats"); err != nil {
+		return err
+	}
 
 	// Error utilities
 	if b.fnGetErrorMessage, err = getFn("qjs_get_error_message"); err != nil {
@@ -597,6 +913,156 @@ func (b *Bridge) hostCallGo(ctx context.Context, m api.Module, ctxPtr, funcID ui
 	return fn(ctxPtr, args)
 }
 
+// hostCallGoPrim dispatches an eager-marshal callback: the batched argument
+// buffer is read in one Memory.Read and the encoded result is written back
+// into the response buffer the C side pre-allocated. Returns the response
+// length, 0 for undefined, or primRespOverflow when the result does not fit.
+func (b *Bridge) hostCallGoPrim(ctx context.Context, m api.Module, ctxPtr, funcID, argsPtr, argsLen, respPtr, respCap uint32) uint32 {
+	b.callbackMu.RLock()
+	fn, ok := b.primCallbacks[funcID]
+	b.callbackMu.RUnlock()
+
+	if !ok {
+		return 0
+	}
+
+	var args []byte
+	if argsLen > 0 {
+		buf, ok := m.Memory().Read(argsPtr, argsLen)
+		if !ok {
+			return 0
+		}
+		args = buf
+	}
+
+	resp := fn(ctxPtr, args)
+	if len(resp) == 0 {
+		return 0
+	}
+	if uint32(len(resp)) > respCap {
+		return primRespOverflow
+	}
+	if !m.Memory().Write(respPtr, resp) {
+		return 0
+	}
+	return uint32(len(resp))
+}
+
+// hostLoadModule resolves an import specifier for the engine's module
+// loader. Cached bytecode is preferred (kind 1); otherwise the host
+// resolver supplies source text (kind 0). Returns 0 if the specifier
+// cannot be resolved, which the C side turns into a ReferenceError.
+func (b *Bridge) hostLoadModule(ctx context.Context, m api.Module, ctxPtr, namePtr, nameLen, outLenPtr, outKindPtr uint32) uint32 {
+	nameBuf, ok := m.Memory().Read(namePtr, nameLen)
+	if !ok {
+		return 0
+	}
+	specifier := string(nameBuf)
+
+	if bytecode, ok := b.moduleCache[specifier]; ok {
+		ptr, err := b.WriteBytes(ctx, bytecode)
+		if err != nil {
+			return 0
+		}
+		m.Memory().WriteUint32Le(outLenPtr, uint32(len(bytecode)))
+		m.Memory().WriteUint32Le(outKindPtr, 1)
+		return ptr
+	}
+
+	if b.moduleLoader == nil {
+		return 0
+	}
+	source, err := b.moduleLoader(specifier)
+	if err != nil {
+		return 0
+	}
+	// +1 for the NUL terminator JS_Eval expects.
+	ptr, err := b.Alloc(ctx, uint32(len(source)+1))
+	if err != nil {
+		return 0
+	}
+	if !m.Memory().WriteString(ptr, source) || !m.Memory().WriteByte(ptr+uint32(len(source)), 0) {
+		return 0
+	}
+	m.Memory().WriteUint32Le(outLenPtr, uint32(len(source)))
+	m.Memory().WriteUint32Le(outKindPtr, 0)
+	return ptr
+}
+
+// hostStoreModule caches the serialized compiled form of a freshly loaded
+// module so later contexts (and later imports) skip the parse.
+func (b *Bridge) hostStoreModule(ctx context.Context, m api.Module, namePtr, nameLen, dataPtr, dataLen uint32) {
+	nameBuf, ok := m.Memory().Read(namePtr, nameLen)
+	if !ok {
+		return
+	}
+	data, ok := m.Memory().Read(dataPtr, dataLen)
+	if !ok {
+		return
+	}
+	// Copy out of linear memory: the engine frees its buffer on return.
+	bytecode := make([]byte, len(data))
+	copy(bytecode, data)
+	b.moduleCache[string(nameBuf)] = bytecode
+}
+
+// SetTimerHost installs the hooks backing host_timer_schedule and
+// host_timer_cancel. Pass nil for both to detach the timer host; scripts
+// calling setTimeout then get an error instead of a timer that never fires.
+func (b *Bridge) SetTimerHost(schedule func(ctxPtr, fnHandle uint32, delayMs float64, repeat bool) uint32, cancel func(id uint32)) {
+	b.timerMu.Lock()
+	defer b.timerMu.Unlock()
+	b.timerSchedule = schedule
+	b.timerCancel = cancel
+}
+
+func (b *Bridge) hostTimerSchedule(ctx context.Context, m api.Module, ctxPtr, fnHandle uint32, delayMs float64, repeat uint32) uint32 {
+	b.timerMu.Lock()
+	schedule := b.timerSchedule
+	b.timerMu.Unlock()
+	if schedule == nil {
+		return 0
+	}
+	return schedule(ctxPtr, fnHandle, delayMs, repeat != 0)
+}
+
+func (b *Bridge) hostTimerCancel(ctx context.Context, m api.Module, timerID uint32) {
+	b.timerMu.Lock()
+	cancel := b.timerCancel
+	b.timerMu.Unlock()
+	if cancel != nil {
+		cancel(timerID)
+	}
+}
+
+// SetWatermarkFunc installs the hook backing host_memory_watermark. The
+// hook runs on the goroutine executing WASM, with the runtime lock held.
+func (b *Bridge) SetWatermarkFunc(fn func(rtPtr uint32, usedBytes uint64)) {
+	b.timerMu.Lock()
+	defer b.timerMu.Unlock()
+	b.watermarkFunc = fn
+}
+
+func (b *Bridge) hostMemoryWatermark(ctx context.Context, m api.Module, rtPtr uint32, usedBytes uint64) {
+	b.timerMu.Lock()
+	fn := b.watermarkFunc
+	b.timerMu.Unlock()
+	if fn != nil {
+		fn(rtPtr, usedBytes)
+	}
+}
+
+// SetModuleLoader installs the resolver consulted by hostLoadModule.
+func (b *Bridge) SetModuleLoader(fn func(specifier string) (string, error)) {
+	b.moduleLoader = fn
+}
+
+// EnableModuleLoader points the engine's module loader at the host hook.
+func (b *Bridge) EnableModuleLoader(ctx context.Context, rtPtr uint32) error {
+	_, err := b.fnEnableModuleLoader.Call(ctx, uint64(rtPtr))
+	return err
+}
+
 // Memory management helpers
 
 // Alloc allocates memory in WASM heap and returns the pointer.
@@ -689,6 +1155,36 @@ func (b *Bridge) Memory() api.Memory {
 	return b.memory
 }
 
+// SnapshotMemory returns a copy of the entire WASM linear memory. Must only
+// be called while no WASM call is in progress so the module is quiescent.
+func (b *Bridge) SnapshotMemory() ([]byte, error) {
+	size := b.memory.Size()
+	buf, ok := b.memory.Read(0, size)
+	if !ok {
+		return nil, errors.New("failed to read WASM memory")
+	}
+	out := make([]byte, size)
+	copy(out, buf)
+	return out, nil
+}
+
+// RestoreMemory overwrites the WASM linear memory with a snapshot, growing
+// the memory first if the snapshot is larger than the current size.
+func (b *Bridge) RestoreMemory(snapshot []byte) error {
+	const wasmPageSize = 65536
+	cur := b.memory.Size()
+	if uint32(len(snapshot)) > cur {
+		delta := (uint32(len(snapshot)) - cur + wasmPageSize - 1) / wasmPageSize
+		if _, ok := b.memory.Grow(delta); !ok {
+			return errors.New("failed to grow WASM memory for snapshot")
+		}
+	}
+	if !b.memory.Write(0, snapshot) {
+		return errors.New("failed to write snapshot to WASM memory")
+	}
+	return nil
+}
+
 // ============================================================================
 // Runtime and Context Management
 // ============================================================================
@@ -731,6 +1227,32 @@ func (b *Bridge) FreeContext(ctx context.Context, ctxPtr uint32) error {
 	return err
 }
 
+// ContextBaseline snapshots the global object's own property names as the
+// context's reset baseline, replacing any previous snapshot.
+func (b *Bridge) ContextBaseline(ctx context.Context, ctxPtr uint32) error {
+	results, err := b.fnContextBaseline.Call(ctx, uint64(ctxPtr))
+	if err != nil {
+		return err
+	}
+	if int32(results[0]) != 0 {
+		return errors.New("failed to snapshot context baseline")
+	}
+	return nil
+}
+
+// ContextReset deletes every global property added since the baseline
+// snapshot and clears any pending exception.
+func (b *Bridge) ContextReset(ctx context.Context, ctxPtr uint32) error {
+	results, err := b.fnContextReset.Call(ctx, uint64(ctxPtr))
+	if err != nil {
+		return err
+	}
+	if int32(results[0]) != 0 {
+		return errors.New("failed to reset context (no baseline snapshot?)")
+	}
+	return nil
+}
+
 // GetRuntime gets the runtime from a context.
 func (b *Bridge) GetRuntime(ctx context.Context, ctxPtr uint32) (uint32, error) {
 	results, err := b.fnGetRuntime.Call(ctx, uint64(ctxPtr))
@@ -746,6 +1268,20 @@ func (b *Bridge) AddConsole(ctx context.Context, ctxPtr uint32) error {
 	return err
 }
 
+// AddTimers installs setTimeout/setInterval/clearTimeout/clearInterval/
+// queueMicrotask natives on the context's global object. They schedule
+// through the timer host hooks (SetTimerHost).
+func (b *Bridge) AddTimers(ctx context.Context, ctxPtr uint32) error {
+	results, err := b.fnAddTimers.Call(ctx, uint64(ctxPtr))
+	if err != nil {
+		return err
+	}
+	if int32(results[0]) != 0 {
+		return errors.New("failed to install timer natives")
+	}
+	return nil
+}
+
 // ============================================================================
 // Evaluation
 // ============================================================================
@@ -772,58 +1308,280 @@ func (b *Bridge) Eval(ctx context.Context, ctxPtr uint32, code, filename string,
 	return uint32(results[0]), nil
 }
 
-// EvalModule evaluates JavaScript module code.
-func (b *Bridge) EvalModule(ctx context.Context, ctxPtr uint32, code, filename string) (uint32, error) {
+// Primitive result tags, mirroring PRIM_RES_* in csrc/bridge.c.
+const (
+	PrimUndefined = iota // no payload
+	PrimNull             // no payload
+	PrimBool             // payload is 0 or 1
+	PrimInt32            // payload is a zero-extended int32
+	PrimFloat64          // payload is float64 bits
+	PrimHandle           // payload is a slot handle (non-primitive result)
+	PrimException        // exception left pending in the context
+)
+
+// PrimResult is the tagged union qjs_eval_prim/qjs_call_prim write into a
+// caller-provided arena address: primitives come back inline in a single
+// crossing with no slot traffic, non-primitives fall back to a slot handle.
+type PrimResult struct {
+	Tag     uint32
+	Payload uint64
+}
+
+// EvalPrim evaluates JavaScript code, returning primitive results inline
+// instead of through the slot table.
+func (b *Bridge) EvalPrim(ctx context.Context, ctxPtr uint32, code, filename string, flags int32) (PrimResult, error) {
+	// The result union is carved from the arena before the code upload so a
+	// wrap-on-full reset cannot invalidate the staged script.
+	outPtr, err := b.Alloc(ctx, 16)
+	if err != nil {
+		return PrimResult{}, err
+	}
+
 	codePtr, err := b.WriteString(ctx, code)
 	if err != nil {
-		return 0, err
+		return PrimResult{}, err
 	}
 
 	var filenamePtr uint32
 	if filename != "" {
 		filenamePtr, err = b.WriteString(ctx, filename)
 		if err != nil {
-			return 0, err
+			return PrimResult{}, err
 		}
 	}
 
-	results, err := b.fnEvalModule.Call(ctx, uint64(ctxPtr), uint64(codePtr), uint64(len(code)), uint64(filenamePtr))
-	if err != nil {
-		return 0, err
+	if _, err = b.fnEvalPrim.Call(ctx, uint64(ctxPtr), uint64(codePtr), uint64(len(code)), uint64(filenamePtr), uint64(flags), uint64(outPtr)); err != nil {
+		return PrimResult{}, err
 	}
-	return uint32(results[0]), nil
+	buf, ok := b.memory.Read(outPtr, 16)
+	if !ok {
+		return PrimResult{}, errors.New("failed to read primitive result")
+	}
+	return PrimResult{
+		Tag:     binary.LittleEndian.Uint32(buf),
+		Payload: binary.LittleEndian.Uint64(buf[8:]),
+	}, nil
 }
 
-// ============================================================================
-// Type Checking
-// ============================================================================
+// evalStreamChunkSize is the staging granularity for EvalStream. Each chunk
+// passes through the arena, so it must stay well below ARENA_SIZE.
+const evalStreamChunkSize = 256 * 1024
 
-func (b *Bridge) IsException(ctx context.Context, valPtr uint32) (bool, error) {
-	results, err := b.fnIsException.Call(ctx, uint64(valPtr))
+// EvalStream evaluates a script of arbitrary size by uploading it in chunks
+// into engine-malloc'd memory, bypassing the arena's size limit. sizeHint
+// (0 if unknown) pre-sizes the accumulation buffer.
+func (b *Bridge) EvalStream(ctx context.Context, ctxPtr uint32, r io.Reader, sizeHint uint32, filename string, flags int32) (uint32, error) {
+	results, err := b.fnEvalBegin.Call(ctx, uint64(ctxPtr), uint64(sizeHint))
 	if err != nil {
-		return false, err
+		return 0, err
 	}
-	return results[0] != 0, nil
-}
-
-func (b *Bridge) IsUndefined(ctx context.Context, valPtr uint32) (bool, error) {
-	results, err := b.fnIsUndefined.Call(ctx, uint64(valPtr))
-	if err != nil {
-		return false, err
+	if results[0] == 0 {
+		return 0, errors.New("failed to open eval stream")
 	}
-	return results[0] != 0, nil
-}
-
-func (b *Bridge) IsNull(ctx context.Context, valPtr uint32) (bool, error) {
-	results, err := b.fnIsNull.Call(ctx, uint64(valPtr))
-	if err != nil {
-		return false, err
+	abort := func() {
+		_, _ = b.fnEvalAbort.Call(ctx)
 	}
-	return results[0] != 0, nil
-}
 
-func (b *Bridge) IsBool(ctx context.Context, valPtr uint32) (bool, error) {
-	results, err := b.fnIsBool.Call(ctx, uint64(valPtr))
+	buf := make([]byte, evalStreamChunkSize)
+	for {
+		n, readErr := r.Read(buf)
+		if n > 0 {
+			chunkPtr, err := b.WriteBytes(ctx, buf[:n])
+			if err != nil {
+				abort()
+				return 0, err
+			}
+			results, err = b.fnEvalChunk.Call(ctx, uint64(chunkPtr), uint64(n))
+			if err != nil {
+				abort()
+				return 0, err
+			}
+			if results[0] == 0 {
+				// qjs_eval_chunk resets the stream itself on realloc failure.
+				return 0, errors.New("failed to append eval stream chunk")
+			}
+		}
+		if readErr == io.EOF {
+			break
+		}
+		if readErr != nil {
+			abort()
+			return 0, readErr
+		}
+	}
+
+	var filenamePtr uint32
+	if filename != "" {
+		filenamePtr, err = b.WriteString(ctx, filename)
+		if err != nil {
+			abort()
+			return 0, err
+		}
+	}
+
+	results, err = b.fnEvalFinish.Call(ctx, uint64(filenamePtr), uint64(flags))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// EvalModule evaluates JavaScript module code.
+func (b *Bridge) EvalModule(ctx context.Context, ctxPtr uint32, code, filename string) (uint32, error) {
+	codePtr, err := b.WriteString(ctx, code)
+	if err != nil {
+		return 0, err
+	}
+
+	var filenamePtr uint32
+	if filename != "" {
+		filenamePtr, err = b.WriteString(ctx, filename)
+		if err != nil {
+			return 0, err
+		}
+	}
+
+	results, err := b.fnEvalModule.Call(ctx, uint64(ctxPtr), uint64(codePtr), uint64(len(code)), uint64(filenamePtr))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// Compile compiles JavaScript code to serialized bytecode without executing
+// it. A nil result with nil error means a compile exception is pending in
+// the context.
+func (b *Bridge) Compile(ctx context.Context, ctxPtr uint32, code, filename string, flags int32) ([]byte, error) {
+	codePtr, err := b.WriteString(ctx, code)
+	if err != nil {
+		return nil, err
+	}
+
+	var filenamePtr uint32
+	if filename != "" {
+		filenamePtr, err = b.WriteString(ctx, filename)
+		if err != nil {
+			return nil, err
+		}
+	}
+
+	outLenPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return nil, err
+	}
+
+	results, err := b.fnCompile.Call(ctx, uint64(ctxPtr), uint64(codePtr), uint64(len(code)), uint64(filenamePtr), uint64(flags), uint64(outLenPtr))
+	if err != nil {
+		return nil, err
+	}
+	bufPtr := uint32(results[0])
+	if bufPtr == 0 {
+		return nil, nil
+	}
+
+	lenBuf, ok := b.memory.Read(outLenPtr, 4)
+	if !ok {
+		return nil, errors.New("failed to read bytecode length")
+	}
+	length := binary.LittleEndian.Uint32(lenBuf)
+
+	bytecode := b.ReadBytes(bufPtr, length)
+	_, _ = b.fnFreeBytecode.Call(ctx, uint64(ctxPtr), uint64(bufPtr))
+	if bytecode == nil {
+		return nil, errors.New("failed to read bytecode from WASM memory")
+	}
+	return bytecode, nil
+}
+
+// CloneWrite serializes a value for structured-clone transfer to another
+// runtime. A nil result with nil error means a serialization exception is
+// pending in the context.
+func (b *Bridge) CloneWrite(ctx context.Context, ctxPtr, valPtr uint32) ([]byte, error) {
+	outLenPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return nil, err
+	}
+
+	results, err := b.fnCloneWrite.Call(ctx, uint64(ctxPtr), uint64(valPtr), uint64(outLenPtr))
+	if err != nil {
+		return nil, err
+	}
+	bufPtr := uint32(results[0])
+	if bufPtr == 0 {
+		return nil, nil
+	}
+
+	lenBuf, ok := b.memory.Read(outLenPtr, 4)
+	if !ok {
+		return nil, errors.New("failed to read clone length")
+	}
+	length := binary.LittleEndian.Uint32(lenBuf)
+
+	data := b.ReadBytes(bufPtr, length)
+	_, _ = b.fnFreeBytecode.Call(ctx, uint64(ctxPtr), uint64(bufPtr))
+	if data == nil {
+		return nil, errors.New("failed to read clone data from WASM memory")
+	}
+	return data, nil
+}
+
+// CloneRead deserializes a structured-clone buffer produced by CloneWrite,
+// possibly into a different context than the one that wrote it.
+func (b *Bridge) CloneRead(ctx context.Context, ctxPtr uint32, data []byte) (uint32, error) {
+	bufPtr, err := b.WriteBytes(ctx, data)
+	if err != nil {
+		return 0, err
+	}
+	results, err := b.fnCloneRead.Call(ctx, uint64(ctxPtr), uint64(bufPtr), uint64(len(data)))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// EvalBytecode deserializes and executes bytecode produced by Compile.
+func (b *Bridge) EvalBytecode(ctx context.Context, ctxPtr uint32, bytecode []byte) (uint32, error) {
+	bufPtr, err := b.WriteBytes(ctx, bytecode)
+	if err != nil {
+		return 0, err
+	}
+	results, err := b.fnEvalBytecode.Call(ctx, uint64(ctxPtr), uint64(bufPtr), uint64(len(bytecode)))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// ============================================================================
+// Type Checking
+// ============================================================================
+
+func (b *Bridge) IsException(ctx context.Context, valPtr uint32) (bool, error) {
+	results, err := b.fnIsException.Call(ctx, uint64(valPtr))
+	if err != nil {
+		return false, err
+	}
+	return results[0] != 0, nil
+}
+
+func (b *Bridge) IsUndefined(ctx context.Context, valPtr uint32) (bool, error) {
+	results, err := b.fnIsUndefined.Call(ctx, uint64(valPtr))
+	if err != nil {
+		return false, err
+	}
+	return results[0] != 0, nil
+}
+
+func (b *Bridge) IsNull(ctx context.Context, valPtr uint32) (bool, error) {
+	results, err := b.fnIsNull.Call(ctx, uint64(valPtr))
+	if err != nil {
+		return false, err
+	}
+	return results[0] != 0, nil
+}
+
+func (b *Bridge) IsBool(ctx context.Context, valPtr uint32) (bool, error) {
+	results, err := b.fnIsBool.Call(ctx, uint64(valPtr))
 	if err != nil {
 		return false, err
 	}
@@ -1134,6 +1892,45 @@ func (b *Bridge) SetProperty(ctx context.Context, ctxPtr, objPtr uint32, prop st
 	return nil
 }
 
+// NewAtom interns a property name inside the engine and returns its atom.
+// The atom stays valid until released with FreeAtom, so the host can cache
+// it and skip the string copy and UTF-8 decode on later accesses.
+func (b *Bridge) NewAtom(ctx context.Context, ctxPtr uint32, name string) (uint32, error) {
+	strPtr, err := b.WriteString(ctx, name)
+	if err != nil {
+		return 0, err
+	}
+	results, err := b.fnNewAtom.Call(ctx, uint64(ctxPtr), uint64(strPtr), uint64(len(name)))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+func (b *Bridge) FreeAtom(ctx context.Context, ctxPtr, atom uint32) error {
+	_, err := b.fnFreeAtom.Call(ctx, uint64(ctxPtr), uint64(atom))
+	return err
+}
+
+func (b *Bridge) GetPropertyAtom(ctx context.Context, ctxPtr, objPtr, atom uint32) (uint32, error) {
+	results, err := b.fnGetPropertyAtom.Call(ctx, uint64(ctxPtr), uint64(objPtr), uint64(atom))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+func (b *Bridge) SetPropertyAtom(ctx context.Context, ctxPtr, objPtr, atom, valPtr uint32) error {
+	results, err := b.fnSetPropertyAtom.Call(ctx, uint64(ctxPtr), uint64(objPtr), uint64(atom), uint64(valPtr))
+	if err != nil {
+		return err
+	}
+	if int32(results[0]) < 0 {
+		return errors.New("failed to set property")
+	}
+	return nil
+}
+
 func (b *Bridge) HasProperty(ctx context.Context, ctxPtr, objPtr uint32, prop string) (bool, error) {
 	propPtr, err := b.WriteString(ctx, prop)
 	if err != nil {
@@ -1161,6 +1958,79 @@ func (b *Bridge) DeleteProperty(ctx context.Context, ctxPtr, objPtr uint32, prop
 	return nil
 }
 
+// packPropertyNames concatenates property names as NUL-terminated strings
+// for the batched property exports.
+func packPropertyNames(props []string) []byte {
+	total := 0
+	for _, p := range props {
+		total += len(p) + 1
+	}
+	buf := make([]byte, 0, total)
+	for _, p := range props {
+		buf = append(buf, p...)
+		buf = append(buf, 0)
+	}
+	return buf
+}
+
+// GetProperties reads multiple properties of an object in a single WASM
+// crossing and returns their value pointers in input order.
+func (b *Bridge) GetProperties(ctx context.Context, ctxPtr, objPtr uint32, props []string) ([]uint32, error) {
+	namesPtr, err := b.WriteBytes(ctx, packPropertyNames(props))
+	if err != nil {
+		return nil, err
+	}
+	outPtr, err := b.Alloc(ctx, uint32(len(props))*4)
+	if err != nil {
+		return nil, err
+	}
+
+	results, err := b.fnGetProperties.Call(ctx, uint64(ctxPtr), uint64(objPtr), uint64(namesPtr), uint64(len(props)), uint64(outPtr))
+	if err != nil {
+		return nil, err
+	}
+	if int32(results[0]) != 0 {
+		return nil, errors.New("failed to get properties")
+	}
+
+	raw, ok := b.memory.Read(outPtr, uint32(len(props))*4)
+	if !ok {
+		return nil, errors.New("failed to read property results from WASM memory")
+	}
+	valPtrs := make([]uint32, len(props))
+	for i := range valPtrs {
+		valPtrs[i] = binary.LittleEndian.Uint32(raw[i*4:])
+	}
+	return valPtrs, nil
+}
+
+// SetProperties sets multiple properties of an object in a single WASM
+// crossing. props and valPtrs must have the same length.
+func (b *Bridge) SetProperties(ctx context.Context, ctxPtr, objPtr uint32, props []string, valPtrs []uint32) error {
+	namesPtr, err := b.WriteBytes(ctx, packPropertyNames(props))
+	if err != nil {
+		return err
+	}
+
+	valBuf := make([]byte, len(valPtrs)*4)
+	for i, p := range valPtrs {
+		binary.LittleEndian.PutUint32(valBuf[i*4:], p)
+	}
+	valsPtr, err := b.WriteBytes(ctx, valBuf)
+	if err != nil {
+		return err
+	}
+
+	results, err := b.fnSetProperties.Call(ctx, uint64(ctxPtr), uint64(objPtr), uint64(namesPtr), uint64(valsPtr), uint64(len(props)))
+	if err != nil {
+		return err
+	}
+	if int32(results[0]) != 0 {
+		return errors.New("failed to set properties")
+	}
+	return nil
+}
+
 func (b *Bridge) GetPropertyUint32(ctx context.Context, ctxPtr, objPtr, idx uint32) (uint32, error) {
 	results, err := b.fnGetPropertyUint32.Call(ctx, uint64(ctxPtr), uint64(objPtr), uint64(idx))
 	if err != nil {
@@ -1219,6 +2089,43 @@ func (b *Bridge) Call(ctx context.Context, ctxPtr, funcPtr, thisPtr uint32, args
 	return uint32(results[0]), nil
 }
 
+// CallPrim calls a function, returning primitive results inline instead of
+// through the slot table (see PrimResult).
+func (b *Bridge) CallPrim(ctx context.Context, ctxPtr, funcPtr, thisPtr uint32, args []uint32) (PrimResult, error) {
+	outPtr, err := b.Alloc(ctx, 16)
+	if err != nil {
+		return PrimResult{}, err
+	}
+
+	argc := int32(len(args))
+	var argvPtr uint32
+	if argc > 0 {
+		argvPtr, err = b.Alloc(ctx, uint32(argc)*4)
+		if err != nil {
+			return PrimResult{}, err
+		}
+		argBuf := make([]byte, argc*4)
+		for i, arg := range args {
+			binary.LittleEndian.PutUint32(argBuf[i*4:], arg)
+		}
+		if !b.memory.Write(argvPtr, argBuf) {
+			return PrimResult{}, errors.New("failed to write arguments to WASM memory")
+		}
+	}
+
+	if _, err = b.fnCallPrim.Call(ctx, uint64(ctxPtr), uint64(funcPtr), uint64(thisPtr), uint64(argc), uint64(argvPtr), uint64(outPtr)); err != nil {
+		return PrimResult{}, err
+	}
+	buf, ok := b.memory.Read(outPtr, 16)
+	if !ok {
+		return PrimResult{}, errors.New("failed to read primitive result")
+	}
+	return PrimResult{
+		Tag:     binary.LittleEndian.Uint32(buf),
+		Payload: binary.LittleEndian.Uint64(buf[8:]),
+	}, nil
+}
+
 func (b *Bridge) CallConstructor(ctx context.Context, ctxPtr, funcPtr uint32, args []uint32) (uint32, error) {
 	argc := int32(len(args))
 	var argvPtr uint32
@@ -1387,6 +2294,56 @@ func (b *Bridge) JSONStringify(ctx context.Context, ctxPtr, valPtr uint32) (stri
 	return b.ToString(ctx, ctxPtr, strValPtr)
 }
 
+// JSONParseBytes parses JSON directly from a byte slice, staging the bytes
+// into WASM memory without the string conversion JSONParse would need.
+func (b *Bridge) JSONParseBytes(ctx context.Context, ctxPtr uint32, data []byte) (uint32, error) {
+	// +1 for the NUL terminator the tokenizer expects.
+	jsonPtr, err := b.Alloc(ctx, uint32(len(data)+1))
+	if err != nil {
+		return 0, err
+	}
+	if !b.memory.Write(jsonPtr, data) || !b.memory.WriteByte(jsonPtr+uint32(len(data)), 0) {
+		return 0, errors.New("failed to write JSON to WASM memory")
+	}
+	results, err := b.fnJSONParse.Call(ctx, uint64(ctxPtr), uint64(jsonPtr), uint64(len(data)))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// JSONStringifyView serializes a value and returns the JSON bytes as a view
+// aliasing WASM linear memory, plus a release func that frees the engine's
+// string. The view is valid only until release is called and must be
+// consumed while the runtime lock is held. A nil view with nil error means
+// an exception is pending.
+func (b *Bridge) JSONStringifyView(ctx context.Context, ctxPtr, valPtr uint32) ([]byte, func(), error) {
+	lenPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	results, err := b.fnJSONStringifyLen.Call(ctx, uint64(ctxPtr), uint64(valPtr), uint64(lenPtr))
+	if err != nil {
+		return nil, nil, err
+	}
+	strPtr := uint32(results[0])
+	if strPtr == 0 {
+		return nil, nil, nil
+	}
+
+	strLen, _ := b.memory.ReadUint32Le(lenPtr)
+	view, ok := b.memory.Read(strPtr, strLen)
+	if !ok {
+		_, _ = b.fnFreeCString.Call(ctx, uint64(ctxPtr), uint64(strPtr))
+		return nil, nil, errors.New("failed to read JSON from WASM memory")
+	}
+	release := func() {
+		_, _ = b.fnFreeCString.Call(ctx, uint64(ctxPtr), uint64(strPtr))
+	}
+	return view, release, nil
+}
+
 // ============================================================================
 // Garbage Collection
 // ============================================================================
@@ -1396,6 +2353,29 @@ func (b *Bridge) RunGC(ctx context.Context, rtPtr uint32) error {
 	return err
 }
 
+// ComputeMemoryUsage returns the engine's internal memory accounting as 11
+// int64s in the order documented on qjs_compute_memory_usage.
+func (b *Bridge) ComputeMemoryUsage(ctx context.Context, rtPtr uint32) ([11]int64, error) {
+	var out [11]int64
+
+	outPtr, err := b.Alloc(ctx, 11*8)
+	if err != nil {
+		return out, err
+	}
+	if _, err := b.fnComputeMemoryUsage.Call(ctx, uint64(rtPtr), uint64(outPtr)); err != nil {
+		return out, err
+	}
+
+	buf, ok := b.memory.Read(outPtr, 11*8)
+	if !ok {
+		return out, errors.New("failed to read memory usage from WASM memory")
+	}
+	for i := range out {
+		out[i] = int64(binary.LittleEndian.Uint64(buf[i*8:]))
+	}
+	return out, nil
+}
+
 // ============================================================================
 // Promise Handling
 // ============================================================================
@@ -1408,6 +2388,36 @@ func (b *Bridge) ExecutePendingJobs(ctx context.Context, rtPtr uint32) (int32, e
 	return int32(results[0]), nil
 }
 
+// ExecutePendingJob executes at most one pending job. Returns 1 if a job
+// ran, 0 if the queue was empty, -1 on error.
+func (b *Bridge) ExecutePendingJob(ctx context.Context, rtPtr uint32) (int32, error) {
+	results, err := b.fnExecutePendingJob.Call(ctx, uint64(rtPtr))
+	if err != nil {
+		return -1, err
+	}
+	return int32(results[0]), nil
+}
+
+// PromiseState returns 0 (pending), 1 (fulfilled), 2 (rejected), or -1 if
+// the value is not a promise.
+func (b *Bridge) PromiseState(ctx context.Context, ctxPtr, valPtr uint32) (int32, error) {
+	results, err := b.fnPromiseState.Call(ctx, uint64(ctxPtr), uint64(valPtr))
+	if err != nil {
+		return -1, err
+	}
+	return int32(results[0]), nil
+}
+
+// PromiseResult returns the settled value of a promise (fulfillment value
+// or rejection reason).
+func (b *Bridge) PromiseResult(ctx context.Context, ctxPtr, valPtr uint32) (uint32, error) {
+	results, err := b.fnPromiseResult.Call(ctx, uint64(ctxPtr), uint64(valPtr))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
 // ============================================================================
 // BigInt
 // ============================================================================
@@ -1527,6 +2537,212 @@ func (b *Bridge) GetArrayBuffer(ctx context.Context, ctxPtr, valPtr uint32) ([]b
 	return b.ReadBytes(bufPtr, length), nil
 }
 
+// GetArrayBufferRegion returns the offset and length of an ArrayBuffer's
+// backing store inside WASM linear memory, without copying the data.
+func (b *Bridge) GetArrayBufferRegion(ctx context.Context, ctxPtr, valPtr uint32) (uint32, uint32, error) {
+	lenPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return 0, 0, err
+	}
+
+	results, err := b.fnGetArrayBuffer.Call(ctx, uint64(ctxPtr), uint64(valPtr), uint64(lenPtr))
+	if err != nil {
+		return 0, 0, err
+	}
+	bufPtr := uint32(results[0])
+	if bufPtr == 0 {
+		return 0, 0, errors.New("not an ArrayBuffer")
+	}
+
+	lenBuf, ok := b.memory.Read(lenPtr, 4)
+	if !ok {
+		return 0, 0, errors.New("failed to read length")
+	}
+	return bufPtr, binary.LittleEndian.Uint32(lenBuf), nil
+}
+
+// MemoryView returns a slice aliasing a region of WASM linear memory.
+// Writes through the slice are visible to the engine. The view is
+// invalidated if the WASM memory grows, so it must not be retained across
+// calls that may allocate inside the engine.
+func (b *Bridge) MemoryView(ptr, length uint32) ([]byte, error) {
+	buf, ok := b.memory.Read(ptr, length)
+	if !ok {
+		return nil, errors.New("failed to view WASM memory")
+	}
+	return buf, nil
+}
+
+// NewUninitArrayBuffer creates a zero-filled ArrayBuffer of the given size
+// and returns its value pointer along with the offset of its backing store
+// in WASM memory, so the host can fill it in place.
+func (b *Bridge) NewUninitArrayBuffer(ctx context.Context, ctxPtr, length uint32) (uint32, uint32, error) {
+	outPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return 0, 0, err
+	}
+	results, err := b.fnNewUninitArrayBuf.Call(ctx, uint64(ctxPtr), uint64(length), uint64(outPtr))
+	if err != nil {
+		return 0, 0, err
+	}
+	valPtr := uint32(results[0])
+
+	dataBuf, ok := b.memory.Read(outPtr, 4)
+	if !ok {
+		return 0, 0, errors.New("failed to read data pointer")
+	}
+	return valPtr, binary.LittleEndian.Uint32(dataBuf), nil
+}
+
+// Typed array element types, matching JSTypedArrayEnum in quickjs.h.
+const (
+	TypedArrayInt32   = 5
+	TypedArrayFloat64 = 11
+)
+
+// NewTypedArray creates a typed array of the given element type and writes
+// data (the packed little-endian element bytes) into its backing store with
+// a single Memory.Write.
+func (b *Bridge) NewTypedArray(ctx context.Context, ctxPtr uint32, arrayType int32, data []byte) (uint32, error) {
+	outPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return 0, err
+	}
+	results, err := b.fnNewTypedArray.Call(ctx, uint64(ctxPtr), uint64(uint32(arrayType)), uint64(len(data)), uint64(outPtr))
+	if err != nil {
+		return 0, err
+	}
+	valPtr := uint32(results[0])
+
+	dataPtr, ok := b.memory.ReadUint32Le(outPtr)
+	if !ok {
+		return 0, errors.New("failed to read data pointer")
+	}
+	if dataPtr == 0 {
+		// Creation threw; the handle carries the exception.
+		return valPtr, nil
+	}
+	if len(data) > 0 && !b.memory.Write(dataPtr, data) {
+		return 0, errors.New("failed to write typed array data")
+	}
+	return valPtr, nil
+}
+
+// GetTypedArrayInfo describes a typed array for bulk reads: the linear-
+// memory address of its element data, its byte length, element size and
+// JSTypedArrayEnum type. ok is false if the value is not a typed array.
+func (b *Bridge) GetTypedArrayInfo(ctx context.Context, ctxPtr, valPtr uint32) (dataPtr, byteLen, elemSize uint32, arrayType int32, ok bool, err error) {
+	outPtr, err := b.Alloc(ctx, 16)
+	if err != nil {
+		return 0, 0, 0, 0, false, err
+	}
+	results, err := b.fnGetTypedArrayInfo.Call(ctx, uint64(ctxPtr), uint64(valPtr), uint64(outPtr))
+	if err != nil {
+		return 0, 0, 0, 0, false, err
+	}
+	if results[0] == 0 {
+		return 0, 0, 0, 0, false, nil
+	}
+	buf, memOK := b.memory.Read(outPtr, 16)
+	if !memOK {
+		return 0, 0, 0, 0, false, errors.New("failed to read typed array info")
+	}
+	return binary.LittleEndian.Uint32(buf[0:]),
+		binary.LittleEndian.Uint32(buf[4:]),
+		binary.LittleEndian.Uint32(buf[8:]),
+		int32(binary.LittleEndian.Uint32(buf[12:])),
+		true, nil
+}
+
+// ============================================================================
+// Struct Marshaling
+// ============================================================================
+
+// BuildValue materializes a value graph from the packed marshal wire format
+// in a single WASM crossing.
+func (b *Bridge) BuildValue(ctx context.Context, ctxPtr uint32, data []byte) (uint32, error) {
+	bufPtr, err := b.WriteBytes(ctx, data)
+	if err != nil {
+		return 0, err
+	}
+	results, err := b.fnBuildValue.Call(ctx, uint64(ctxPtr), uint64(bufPtr), uint64(len(data)))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// EncodeValue serializes a value graph into the packed marshal wire format
+// in a single WASM crossing. A nil result with nil error means the encode
+// failed and an exception may be pending in the context.
+func (b *Bridge) EncodeValue(ctx context.Context, ctxPtr, valPtr uint32) ([]byte, error) {
+	outLenPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return nil, err
+	}
+	results, err := b.fnEncodeValue.Call(ctx, uint64(ctxPtr), uint64(valPtr), uint64(outLenPtr))
+	if err != nil {
+		return nil, err
+	}
+	bufPtr := uint32(results[0])
+	if bufPtr == 0 {
+		return nil, nil
+	}
+
+	lenBuf, ok := b.memory.Read(outLenPtr, 4)
+	if !ok {
+		return nil, errors.New("failed to read encoded length")
+	}
+	length := binary.LittleEndian.Uint32(lenBuf)
+
+	data := b.ReadBytes(bufPtr, length)
+	_, _ = b.fnFreeEncoded.Call(ctx, uint64(ctxPtr), uint64(bufPtr))
+	if data == nil && length > 0 {
+		return nil, errors.New("failed to read encoded value from WASM memory")
+	}
+	if data == nil {
+		data = []byte{}
+	}
+	return data, nil
+}
+
+// OwnProperties enumerates an object's own enumerable string-keyed
+// properties in one crossing: u32 count, then per property a u32 key length
+// and key bytes, followed by the marshal-encoded value when withValues is
+// set. A nil result with nil error means the value is not an object or
+// enumeration failed.
+func (b *Bridge) OwnProperties(ctx context.Context, ctxPtr, valPtr uint32, withValues bool) ([]byte, error) {
+	outLenPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return nil, err
+	}
+	var withVals uint64
+	if withValues {
+		withVals = 1
+	}
+	results, err := b.fnOwnProperties.Call(ctx, uint64(ctxPtr), uint64(valPtr), withVals, uint64(outLenPtr))
+	if err != nil {
+		return nil, err
+	}
+	bufPtr := uint32(results[0])
+	if bufPtr == 0 {
+		return nil, nil
+	}
+
+	lenBuf, ok := b.memory.Read(outLenPtr, 4)
+	if !ok {
+		return nil, errors.New("failed to read property list length")
+	}
+	length := binary.LittleEndian.Uint32(lenBuf)
+
+	data := b.ReadBytes(bufPtr, length)
+	_, _ = b.fnFreeEncoded.Call(ctx, uint64(ctxPtr), uint64(bufPtr))
+	if data == nil {
+		return nil, errors.New("failed to read property list from WASM memory")
+	}
+	return data, nil
+}
+
 // ============================================================================
 // C Function Binding (for Go callbacks)
 // ============================================================================
@@ -1542,11 +2758,24 @@ func (b *Bridge) RegisterGoFunc(fn GoFunc) uint32 {
 	return funcID
 }
 
-// UnregisterGoFunc removes a registered Go function.
+// RegisterGoFuncPrim registers an eager-marshal Go function and returns its
+// function ID, drawn from the same ID space as RegisterGoFunc.
+func (b *Bridge) RegisterGoFuncPrim(fn GoFuncPrim) uint32 {
+	b.callbackMu.Lock()
+	defer b.callbackMu.Unlock()
+
+	funcID := b.nextFuncID
+	b.nextFuncID++
+	b.primCallbacks[funcID] = fn
+	return funcID
+}
+
+// UnregisterGoFunc removes a registered Go function of either kind.
 func (b *Bridge) UnregisterGoFunc(funcID uint32) {
 	b.callbackMu.Lock()
 	defer b.callbackMu.Unlock()
 	delete(b.callbacks, funcID)
+	delete(b.primCallbacks, funcID)
 }
 
 // NewCFunction creates a new JavaScript function that calls back to Go.
@@ -1562,6 +2791,82 @@ func (b *Bridge) NewCFunction(ctx context.Context, ctxPtr, funcID uint32, name s
 	return uint32(results[0]), nil
 }
 
+// NewCFunctionPrim creates a new JavaScript function that calls back to Go
+// through the eager-marshal path (host_call_go_prim).
+func (b *Bridge) NewCFunctionPrim(ctx context.Context, ctxPtr, funcID uint32, name string, argCount int32) (uint32, error) {
+	namePtr, err := b.WriteString(ctx, name)
+	if err != nil {
+		return 0, err
+	}
+	results, err := b.fnNewCFunctionPrim.Call(ctx, uint64(ctxPtr), uint64(funcID), uint64(namePtr), uint64(argCount))
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// ============================================================================
+// JS/Go Channel
+// ============================================================================
+
+// ChannelLayout describes the ring buffer's location in linear memory: the
+// producer writes records at BufPtr+tail and maintains the tail index
+// directly through Memory(), without calling into the module.
+type ChannelLayout struct {
+	BufPtr  uint32
+	Cap     uint32
+	HeadPtr uint32
+	TailPtr uint32
+}
+
+// ChannelInit opens the module's channel with cbPtr (a slot handle to a JS
+// function) as the batch callback.
+func (b *Bridge) ChannelInit(ctx context.Context, ctxPtr, cbPtr uint32) (bool, error) {
+	results, err := b.fnChannelInit.Call(ctx, uint64(ctxPtr), uint64(cbPtr))
+	if err != nil {
+		return false, err
+	}
+	return results[0] != 0, nil
+}
+
+// ChannelClose releases the channel's callback and marks it closed.
+func (b *Bridge) ChannelClose(ctx context.Context) error {
+	_, err := b.fnChannelClose.Call(ctx)
+	return err
+}
+
+// ChannelLayout returns the ring buffer layout of the open channel.
+func (b *Bridge) ChannelLayout(ctx context.Context) (ChannelLayout, error) {
+	outPtr, err := b.Alloc(ctx, 16)
+	if err != nil {
+		return ChannelLayout{}, err
+	}
+	if _, err := b.fnChannelLayout.Call(ctx, uint64(outPtr)); err != nil {
+		return ChannelLayout{}, err
+	}
+	buf, ok := b.memory.Read(outPtr, 16)
+	if !ok {
+		return ChannelLayout{}, errors.New("failed to read channel layout")
+	}
+	return ChannelLayout{
+		BufPtr:  binary.LittleEndian.Uint32(buf[0:]),
+		Cap:     binary.LittleEndian.Uint32(buf[4:]),
+		HeadPtr: binary.LittleEndian.Uint32(buf[8:]),
+		TailPtr: binary.LittleEndian.Uint32(buf[12:]),
+	}, nil
+}
+
+// ChannelPoll drains the ring and delivers the batch to the JS callback.
+// Returns the number of events delivered, or -1 if the callback (or record
+// decoding) threw.
+func (b *Bridge) ChannelPoll(ctx context.Context) (int32, error) {
+	results, err := b.fnChannelPoll.Call(ctx)
+	if err != nil {
+		return 0, err
+	}
+	return int32(results[0]), nil
+}
+
 // ============================================================================
 // Runtime Configuration
 // ============================================================================
@@ -1576,6 +2881,131 @@ func (b *Bridge) SetMaxStackSize(ctx context.Context, rtPtr, stackSize uint32) e
 	return err
 }
 
+func (b *Bridge) SetGCThreshold(ctx context.Context, rtPtr, threshold uint32) error {
+	_, err := b.fnSetGCThreshold.Call(ctx, uint64(rtPtr), uint64(threshold))
+	return err
+}
+
+// SetMemoryWatermark arms (or with bytes 0 disarms) the soft memory
+// watermark polled by the interrupt handler. Re-arming resets the one-shot
+// latch.
+func (b *Bridge) SetMemoryWatermark(ctx context.Context, rtPtr uint32, bytes uint64) error {
+	_, err := b.fnSetMemoryWatermark.Call(ctx, uint64(rtPtr), bytes)
+	return err
+}
+
+// InstallInterruptHandler installs the module's interrupt handler on the
+// runtime. The handler reads a flag in linear memory, so the interpreter
+// never crosses the host boundary while checking for interruption.
+func (b *Bridge) InstallInterruptHandler(ctx context.Context, rtPtr uint32) error {
+	_, err := b.fnInstallInterrupt.Call(ctx, uint64(rtPtr))
+	return err
+}
+
+// InterruptFlagPtr returns the linear-memory address of the interrupt flag.
+func (b *Bridge) InterruptFlagPtr(ctx context.Context) (uint32, error) {
+	results, err := b.fnInterruptFlagPtr.Call(ctx)
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
+
+// SetInterruptFlag writes the interrupt flag directly through linear
+// memory. It deliberately takes no lock: it is the one operation designed
+// to fire while another goroutine is inside a WASM call.
+func (b *Bridge) SetInterruptFlag(flagPtr uint32, interrupt bool) {
+	var v uint32
+	if interrupt {
+		v = 1
+	}
+	b.memory.WriteUint32Le(flagPtr, v)
+}
+
+// ============================================================================
+// Sampling Profiler
+// ============================================================================
+
+// ProfileStart arms the sampling profiler for a context. Returns false if a
+// profile is already running.
+func (b *Bridge) ProfileStart(ctx context.Context, ctxPtr uint32) (bool, error) {
+	results, err := b.fnProfileStart.Call(ctx, uint64(ctxPtr))
+	if err != nil {
+		return false, err
+	}
+	return results[0] != 0, nil
+}
+
+// ProfileStop disarms the profiler and returns the serialized report (see
+// qjs_profile_stop for the layout). A nil result with nil error means no
+// profile was running.
+func (b *Bridge) ProfileStop(ctx context.Context, ctxPtr uint32) ([]byte, error) {
+	outLenPtr, err := b.Alloc(ctx, 4)
+	if err != nil {
+		return nil, err
+	}
+	results, err := b.fnProfileStop.Call(ctx, uint64(outLenPtr))
+	if err != nil {
+		return nil, err
+	}
+	bufPtr := uint32(results[0])
+	if bufPtr == 0 {
+		return nil, nil
+	}
+
+	length, ok := b.memory.ReadUint32Le(outLenPtr)
+	if !ok {
+		return nil, errors.New("failed to read profile report length")
+	}
+	data := b.ReadBytes(bufPtr, length)
+	_, _ = b.fnFreeEncoded.Call(ctx, uint64(ctxPtr), uint64(bufPtr))
+	if data == nil && length > 0 {
+		return nil, errors.New("failed to read profile report from WASM memory")
+	}
+	return data, nil
+}
+
+// ============================================================================
+// Regex Compilation Cache
+// ============================================================================
+
+// PrecompileRegexp compiles a pattern so its bytecode lands in the
+// process-wide regex cache. Returns false if the pattern is invalid.
+func (b *Bridge) PrecompileRegexp(ctx context.Context, ctxPtr uint32, pattern, flags string) (bool, error) {
+	patternPtr, err := b.WriteString(ctx, pattern)
+	if err != nil {
+		return false, err
+	}
+	var flagsPtr uint32
+	if flags != "" {
+		flagsPtr, err = b.WriteString(ctx, flags)
+		if err != nil {
+			return false, err
+		}
+	}
+	results, err := b.fnPrecompileRegexp.Call(ctx, uint64(ctxPtr), uint64(patternPtr), uint64(len(pattern)), uint64(flagsPtr))
+	if err != nil {
+		return false, err
+	}
+	return results[0] != 0, nil
+}
+
+// RegexpCacheStats returns cumulative regex cache hits and misses.
+func (b *Bridge) RegexpCacheStats(ctx context.Context) (hits, misses uint64, err error) {
+	outPtr, err := b.Alloc(ctx, 16)
+	if err != nil {
+		return 0, 0, err
+	}
+	if _, err := b.fnRegexpCacheStats.Call(ctx, uint64(outPtr)); err != nil {
+		return 0, 0, err
+	}
+	buf, ok := b.memory.Read(outPtr, 16)
+	if !ok {
+		return 0, 0, errors.New("failed to read regex cache stats")
+	}
+	return binary.LittleEndian.Uint64(buf[0:]), binary.LittleEndian.Uint64(buf[8:]), nil
+}
+
 // ============================================================================
 // Memory Info
 // ============================================================================
@@ -1600,3 +3030,20 @@ func (b *Bridge) ResetHeap(ctx context.Context) error {
 	_, err := b.fnResetHeap.Call(ctx)
 	return err
 }
+
+// ResetSlots reinitializes the JSValue slot table. Only safe after the
+// runtime that owned the stored values has been freed.
+func (b *Bridge) ResetSlots(ctx context.Context) error {
+	_, err := b.fnResetSlots.Call(ctx)
+	return err
+}
+
+// StaleHandleCount returns how many value accesses presented a handle whose
+// slot was recycled after the handle was issued (a Go-side use-after-free).
+func (b *Bridge) StaleHandleCount(ctx context.Context) (uint32, error) {
+	results, err := b.fnStaleHandleCount.Call(ctx)
+	if err != nil {
+		return 0, err
+	}
+	return uint32(results[0]), nil
+}
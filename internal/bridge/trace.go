@@ -0,0 +1,146 @@
+package bridge
+
+import (
+	"context"
+	"encoding/binary"
+	"errors"
+	"sort"
+	"sync/atomic"
+	"time"
+
+	"github.com/tetratelabs/wazero/api"
+)
+
+// Trace mode wraps every exported function the bridge looks up with a
+// nanosecond timer feeding a fixed-bucket latency histogram, so a latency
+// regression can be attributed to boundary crossings (wazero call
+// overhead), engine execution (time inside one export), or memory traffic
+// (the arena and slot counters from qjs_arena_stats/qjs_slot_stats).
+// Disabled tracing costs one atomic load per call.
+
+// TraceBucketCount is the number of histogram buckets per function; the
+// last bucket is the overflow (> the largest bound).
+const TraceBucketCount = 9
+
+// TraceBucketBounds are the inclusive upper bounds, in nanoseconds, of the
+// first TraceBucketCount-1 buckets: 1µs to ~16ms in powers of four.
+var TraceBucketBounds = [TraceBucketCount - 1]uint64{
+	1_000, 4_000, 16_000, 64_000, 256_000, 1_024_000, 4_096_000, 16_384_000,
+}
+
+// FuncTrace is one export's accumulated call statistics.
+type FuncTrace struct {
+	Name       string
+	Calls      uint64
+	TotalNanos uint64
+	Buckets    [TraceBucketCount]uint64
+}
+
+type funcStats struct {
+	calls   atomic.Uint64
+	nanos   atomic.Uint64
+	buckets [TraceBucketCount]atomic.Uint64
+}
+
+func (s *funcStats) record(nanos uint64) {
+	s.calls.Add(1)
+	s.nanos.Add(nanos)
+	for i, bound := range TraceBucketBounds {
+		if nanos <= bound {
+			s.buckets[i].Add(1)
+			return
+		}
+	}
+	s.buckets[TraceBucketCount-1].Add(1)
+}
+
+// tracedFunction decorates an api.Function with timing. All other
+// api.Function methods pass through the embedded value.
+type tracedFunction struct {
+	api.Function
+	b     *Bridge
+	stats *funcStats
+}
+
+func (t *tracedFunction) Call(ctx context.Context, params ...uint64) ([]uint64, error) {
+	if !t.b.traceEnabled.Load() {
+		return t.Function.Call(ctx, params...)
+	}
+	start := time.Now()
+	results, err := t.Function.Call(ctx, params...)
+	t.stats.record(uint64(time.Since(start)))
+	return results, err
+}
+
+// traceWrap registers a stats slot for the export and returns the traced
+// decorator. Called only from initFunctions, before the bridge is shared,
+// so the map needs no locking afterwards (readers only).
+func (b *Bridge) traceWrap(name string, fn api.Function) api.Function {
+	if b.traceStats == nil {
+		b.traceStats = make(map[string]*funcStats)
+	}
+	s := &funcStats{}
+	b.traceStats[name] = s
+	return &tracedFunction{Function: fn, b: b, stats: s}
+}
+
+// EnableTracing starts recording per-export latency histograms. Counters
+// accumulate across Enable/Disable cycles.
+func (b *Bridge) EnableTracing() { b.traceEnabled.Store(true) }
+
+// DisableTracing stops recording; already-accumulated counters remain
+// readable through TraceSnapshot.
+func (b *Bridge) DisableTracing() { b.traceEnabled.Store(false) }
+
+// TraceSnapshot returns the per-export histograms for every export called
+// at least once, busiest (by total time) first.
+func (b *Bridge) TraceSnapshot() []FuncTrace {
+	out := make([]FuncTrace, 0, len(b.traceStats))
+	for name, s := range b.traceStats {
+		calls := s.calls.Load()
+		if calls == 0 {
+			continue
+		}
+		ft := FuncTrace{Name: name, Calls: calls, TotalNanos: s.nanos.Load()}
+		for i := range ft.Buckets {
+			ft.Buckets[i] = s.buckets[i].Load()
+		}
+		out = append(out, ft)
+	}
+	sort.Slice(out, func(i, j int) bool { return out[i].TotalNanos > out[j].TotalNanos })
+	return out
+}
+
+// SlotStats reads slot-table occupancy from the module: handles in use,
+// slots allocated, and stale-handle uses.
+func (b *Bridge) SlotStats(ctx context.Context) (inUse, allocated, stale uint32, err error) {
+	outPtr, err := b.Alloc(ctx, 12)
+	if err != nil {
+		return 0, 0, 0, err
+	}
+	if _, err = b.fnSlotStats.Call(ctx, uint64(outPtr)); err != nil {
+		return 0, 0, 0, err
+	}
+	buf, ok := b.memory.Read(outPtr, 12)
+	if !ok {
+		return 0, 0, 0, errors.New("failed to read slot stats")
+	}
+	return binary.LittleEndian.Uint32(buf), binary.LittleEndian.Uint32(buf[4:]), binary.LittleEndian.Uint32(buf[8:]), nil
+}
+
+// ArenaStats reads arena usage from the module: bytes currently in use,
+// capacity, and how many times the arena has been reset.
+func (b *Bridge) ArenaStats(ctx context.Context) (used, capacity uint32, resets uint64, err error) {
+	outPtr, err := b.Alloc(ctx, 16)
+	if err != nil {
+		return 0, 0, 0, err
+	}
+	if _, err = b.fnArenaStats.Call(ctx, uint64(outPtr)); err != nil {
+		return 0, 0, 0, err
+	}
+	buf, ok := b.memory.Read(outPtr, 16)
+	if !ok {
+		return 0, 0, 0, errors.New("failed to read arena stats")
+	}
+	return binary.LittleEndian.Uint32(buf), binary.LittleEndian.Uint32(buf[4:]), binary.LittleEndian.Uint64(buf[8:]), nil
+}
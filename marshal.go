@@ -0,0 +1,621 @@
+package quickjs
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"math"
+	"reflect"
+)
+
+// Wire format tags shared with qjs_build_value/qjs_encode_value in
+// csrc/bridge.c. All multi-byte fields are little endian.
+const (
+	marshalUndefined = 0
+	marshalNull      = 1
+	marshalFalse     = 2
+	marshalTrue      = 3
+	marshalInt32     = 4
+	marshalFloat64   = 5
+	marshalString    = 6
+	marshalArray     = 7
+	marshalObject    = 8
+)
+
+// Marshal converts a Go value (structs, maps, slices and primitives) into a
+// JavaScript value. The whole object graph is serialized into one packed
+// buffer and materialized inside the engine by a single WASM crossing,
+// instead of one Object/String/Set crossing per node as with the Value API.
+//
+// Struct fields use their `json` tag name when present ("-" skips the
+// field); unexported fields are skipped. Map keys must be strings.
+func (c *Context) Marshal(v any) (Value, error) {
+	buf, err := appendMarshal(nil, reflect.ValueOf(v))
+	if err != nil {
+		return Value{}, err
+	}
+
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	valPtr, err := c.runtime.bridge.BuildValue(c.runtime.goCtx, c.ctxPtr, buf)
+	if err != nil {
+		return Value{}, err
+	}
+	return c.checkException(valPtr)
+}
+
+// Unmarshal converts the JavaScript value into the Go value pointed to by
+// target, serializing the whole graph out of the engine in a single WASM
+// crossing. Supported targets mirror Marshal: structs (honoring `json`
+// tags), maps with string keys, slices, primitives and any.
+func (v Value) Unmarshal(target any) error {
+	if v.ctx == nil {
+		return errors.New("nil value")
+	}
+	rv := reflect.ValueOf(target)
+	if rv.Kind() != reflect.Pointer || rv.IsNil() {
+		return errors.New("unmarshal target must be a non-nil pointer")
+	}
+
+	v.ctx.runtime.lock()
+	data, err := v.ctx.runtime.bridge.EncodeValue(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
+	if err == nil && data == nil {
+		err = v.ctx.pendingError()
+	}
+	v.ctx.runtime.unlock()
+	if err != nil {
+		return err
+	}
+
+	off, err := unmarshalInto(data, 0, rv.Elem())
+	if err != nil {
+		return err
+	}
+	if off != len(data) {
+		return errors.New("trailing data in encoded value")
+	}
+	return nil
+}
+
+// ============================================================================
+// Encoding (Go -> wire format)
+// ============================================================================
+
+func appendMarshal(buf []byte, rv reflect.Value) ([]byte, error) {
+	if !rv.IsValid() {
+		return append(buf, marshalNull), nil
+	}
+
+	switch rv.Kind() {
+	case reflect.Bool:
+		if rv.Bool() {
+			return append(buf, marshalTrue), nil
+		}
+		return append(buf, marshalFalse), nil
+
+	case reflect.Int, reflect.Int8, reflect.Int16, reflect.Int32, reflect.Int64:
+		n := rv.Int()
+		if n >= math.MinInt32 && n <= math.MaxInt32 {
+			buf = append(buf, marshalInt32)
+			return binary.LittleEndian.AppendUint32(buf, uint32(int32(n))), nil
+		}
+		buf = append(buf, marshalFloat64)
+		return binary.LittleEndian.AppendUint64(buf, math.Float64bits(float64(n))), nil
+
+	case reflect.Uint, reflect.Uint8, reflect.Uint16, reflect.Uint32, reflect.Uint64, reflect.Uintptr:
+		n := rv.Uint()
+		if n <= math.MaxInt32 {
+			buf = append(buf, marshalInt32)
+			return binary.LittleEndian.AppendUint32(buf, uint32(n)), nil
+		}
+		buf = append(buf, marshalFloat64)
+		return binary.LittleEndian.AppendUint64(buf, math.Float64bits(float64(n))), nil
+
+	case reflect.Float32, reflect.Float64:
+		buf = append(buf, marshalFloat64)
+		return binary.LittleEndian.AppendUint64(buf, math.Float64bits(rv.Float())), nil
+
+	case reflect.String:
+		s := rv.String()
+		buf = append(buf, marshalString)
+		buf = binary.LittleEndian.AppendUint32(buf, uint32(len(s)))
+		return append(buf, s...), nil
+
+	case reflect.Slice:
+		if rv.IsNil() {
+			return append(buf, marshalNull), nil
+		}
+		fallthrough
+	case reflect.Array:
+		buf = append(buf, marshalArray)
+		buf = binary.LittleEndian.AppendUint32(buf, uint32(rv.Len()))
+		for i := 0; i < rv.Len(); i++ {
+			var err error
+			buf, err = appendMarshal(buf, rv.Index(i))
+			if err != nil {
+				return nil, err
+			}
+		}
+		return buf, nil
+
+	case reflect.Map:
+		if rv.IsNil() {
+			return append(buf, marshalNull), nil
+		}
+		if rv.Type().Key().Kind() != reflect.String {
+			return nil, fmt.Errorf("cannot marshal map with %s keys", rv.Type().Key())
+		}
+		buf = append(buf, marshalObject)
+		buf = binary.LittleEndian.AppendUint32(buf, uint32(rv.Len()))
+		iter := rv.MapRange()
+		for iter.Next() {
+			key := iter.Key().String()
+			buf = binary.LittleEndian.AppendUint32(buf, uint32(len(key)))
+			buf = append(buf, key...)
+			var err error
+			buf, err = appendMarshal(buf, iter.Value())
+			if err != nil {
+				return nil, err
+			}
+		}
+		return buf, nil
+
+	case reflect.Struct:
+		fields := structFields(rv.Type())
+		buf = append(buf, marshalObject)
+		buf = binary.LittleEndian.AppendUint32(buf, uint32(len(fields)))
+		for _, f := range fields {
+			buf = binary.LittleEndian.AppendUint32(buf, uint32(len(f.name)))
+			buf = append(buf, f.name...)
+			var err error
+			buf, err = appendMarshal(buf, rv.Field(f.index))
+			if err != nil {
+				return nil, err
+			}
+		}
+		return buf, nil
+
+	case reflect.Pointer, reflect.Interface:
+		if rv.IsNil() {
+			return append(buf, marshalNull), nil
+		}
+		return appendMarshal(buf, rv.Elem())
+
+	default:
+		return nil, fmt.Errorf("cannot marshal %s", rv.Kind())
+	}
+}
+
+type structField struct {
+	name  string
+	index int
+}
+
+// structFields returns the marshalable fields of a struct type, honoring
+// `json` tag names.
+func structFields(t reflect.Type) []structField {
+	fields := make([]structField, 0, t.NumField())
+	for i := 0; i < t.NumField(); i++ {
+		f := t.Field(i)
+		if !f.IsExported() {
+			continue
+		}
+		name := f.Name
+		if tag, ok := f.Tag.Lookup("json"); ok {
+			for j := 0; j < len(tag); j++ {
+				if tag[j] == ',' {
+					tag = tag[:j]
+					break
+				}
+			}
+			if tag == "-" {
+				continue
+			}
+			if tag != "" {
+				name = tag
+			}
+		}
+		fields = append(fields, structField{name: name, index: i})
+	}
+	return fields
+}
+
+// ============================================================================
+// Decoding (wire format -> Go)
+// ============================================================================
+
+var errTruncated = errors.New("truncated encoded value")
+
+func unmarshalInto(data []byte, off int, rv reflect.Value) (int, error) {
+	if off >= len(data) {
+		return 0, errTruncated
+	}
+	tag := data[off]
+	off++
+
+	switch tag {
+	case marshalUndefined, marshalNull:
+		rv.Set(reflect.Zero(rv.Type()))
+		return off, nil
+
+	case marshalFalse, marshalTrue:
+		return off, assignPrimitive(rv, tag == marshalTrue)
+
+	case marshalInt32:
+		if off+4 > len(data) {
+			return 0, errTruncated
+		}
+		n := int32(binary.LittleEndian.Uint32(data[off:]))
+		return off + 4, assignPrimitive(rv, int64(n))
+
+	case marshalFloat64:
+		if off+8 > len(data) {
+			return 0, errTruncated
+		}
+		f := math.Float64frombits(binary.LittleEndian.Uint64(data[off:]))
+		return off + 8, assignPrimitive(rv, f)
+
+	case marshalString:
+		if off+4 > len(data) {
+			return 0, errTruncated
+		}
+		n := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		if off+n > len(data) {
+			return 0, errTruncated
+		}
+		return off + n, assignPrimitive(rv, string(data[off:off+n]))
+
+	case marshalArray:
+		if off+4 > len(data) {
+			return 0, errTruncated
+		}
+		count := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		return unmarshalArray(data, off, count, rv)
+
+	case marshalObject:
+		if off+4 > len(data) {
+			return 0, errTruncated
+		}
+		count := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		return unmarshalObject(data, off, count, rv)
+
+	default:
+		return 0, fmt.Errorf("bad tag %d in encoded value", tag)
+	}
+}
+
+// assignPrimitive stores a decoded primitive into the target, converting
+// between numeric kinds where possible.
+func assignPrimitive(rv reflect.Value, v any) error {
+	if rv.Kind() == reflect.Pointer {
+		if rv.IsNil() {
+			rv.Set(reflect.New(rv.Type().Elem()))
+		}
+		return assignPrimitive(rv.Elem(), v)
+	}
+	if rv.Kind() == reflect.Interface && rv.NumMethod() == 0 {
+		rv.Set(reflect.ValueOf(v))
+		return nil
+	}
+
+	switch v := v.(type) {
+	case bool:
+		if rv.Kind() != reflect.Bool {
+			return fmt.Errorf("cannot unmarshal boolean into %s", rv.Type())
+		}
+		rv.SetBool(v)
+	case string:
+		if rv.Kind() != reflect.String {
+			return fmt.Errorf("cannot unmarshal string into %s", rv.Type())
+		}
+		rv.SetString(v)
+	case int64:
+		return assignNumber(rv, float64(v))
+	case float64:
+		return assignNumber(rv, v)
+	}
+	return nil
+}
+
+func assignNumber(rv reflect.Value, f float64) error {
+	switch rv.Kind() {
+	case reflect.Int, reflect.Int8, reflect.Int16, reflect.Int32, reflect.Int64:
+		rv.SetInt(int64(f))
+	case reflect.Uint, reflect.Uint8, reflect.Uint16, reflect.Uint32, reflect.Uint64, reflect.Uintptr:
+		rv.SetUint(uint64(f))
+	case reflect.Float32, reflect.Float64:
+		rv.SetFloat(f)
+	default:
+		return fmt.Errorf("cannot unmarshal number into %s", rv.Type())
+	}
+	return nil
+}
+
+func unmarshalArray(data []byte, off, count int, rv reflect.Value) (int, error) {
+	if rv.Kind() == reflect.Pointer {
+		if rv.IsNil() {
+			rv.Set(reflect.New(rv.Type().Elem()))
+		}
+		return unmarshalArray(data, off, count, rv.Elem())
+	}
+
+	switch rv.Kind() {
+	case reflect.Interface:
+		if rv.NumMethod() != 0 {
+			return 0, fmt.Errorf("cannot unmarshal array into %s", rv.Type())
+		}
+		out := make([]any, count)
+		slice := reflect.ValueOf(out)
+		for i := 0; i < count; i++ {
+			var err error
+			off, err = unmarshalInto(data, off, slice.Index(i))
+			if err != nil {
+				return 0, err
+			}
+		}
+		rv.Set(slice)
+		return off, nil
+
+	case reflect.Slice:
+		slice := reflect.MakeSlice(rv.Type(), count, count)
+		for i := 0; i < count; i++ {
+			var err error
+			off, err = unmarshalInto(data, off, slice.Index(i))
+			if err != nil {
+				return 0, err
+			}
+		}
+		rv.Set(slice)
+		return off, nil
+
+	case reflect.Array:
+		for i := 0; i < count; i++ {
+			var err error
+			if i < rv.Len() {
+				off, err = unmarshalInto(data, off, rv.Index(i))
+			} else {
+				off, err = skipValue(data, off)
+			}
+			if err != nil {
+				return 0, err
+			}
+		}
+		return off, nil
+
+	default:
+		return 0, fmt.Errorf("cannot unmarshal array into %s", rv.Type())
+	}
+}
+
+func unmarshalObject(data []byte, off, count int, rv reflect.Value) (int, error) {
+	if rv.Kind() == reflect.Pointer {
+		if rv.IsNil() {
+			rv.Set(reflect.New(rv.Type().Elem()))
+		}
+		return unmarshalObject(data, off, count, rv.Elem())
+	}
+
+	readKey := func() (string, error) {
+		if off+4 > len(data) {
+			return "", errTruncated
+		}
+		n := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		if off+n > len(data) {
+			return "", errTruncated
+		}
+		key := string(data[off : off+n])
+		off += n
+		return key, nil
+	}
+
+	switch rv.Kind() {
+	case reflect.Interface:
+		if rv.NumMethod() != 0 {
+			return 0, fmt.Errorf("cannot unmarshal object into %s", rv.Type())
+		}
+		out := make(map[string]any, count)
+		for i := 0; i < count; i++ {
+			key, err := readKey()
+			if err != nil {
+				return 0, err
+			}
+			var elem any
+			off, err = unmarshalInto(data, off, reflect.ValueOf(&elem).Elem())
+			if err != nil {
+				return 0, err
+			}
+			out[key] = elem
+		}
+		rv.Set(reflect.ValueOf(out))
+		return off, nil
+
+	case reflect.Map:
+		if rv.Type().Key().Kind() != reflect.String {
+			return 0, fmt.Errorf("cannot unmarshal object into map with %s keys", rv.Type().Key())
+		}
+		m := reflect.MakeMapWithSize(rv.Type(), count)
+		for i := 0; i < count; i++ {
+			key, err := readKey()
+			if err != nil {
+				return 0, err
+			}
+			elem := reflect.New(rv.Type().Elem()).Elem()
+			off, err = unmarshalInto(data, off, elem)
+			if err != nil {
+				return 0, err
+			}
+			m.SetMapIndex(reflect.ValueOf(key).Convert(rv.Type().Key()), elem)
+		}
+		rv.Set(m)
+		return off, nil
+
+	case reflect.Struct:
+		byName := make(map[string]int)
+		for _, f := range structFields(rv.Type()) {
+			byName[f.name] = f.index
+		}
+		for i := 0; i < count; i++ {
+			key, err := readKey()
+			if err != nil {
+				return 0, err
+			}
+			if idx, ok := byName[key]; ok {
+				off, err = unmarshalInto(data, off, rv.Field(idx))
+			} else {
+				off, err = skipValue(data, off)
+			}
+			if err != nil {
+				return 0, err
+			}
+		}
+		return off, nil
+
+	default:
+		return 0, fmt.Errorf("cannot unmarshal object into %s", rv.Type())
+	}
+}
+
+// decodePrimArgs decodes the batched callback argument buffer produced by
+// go_callback_wrapper_prim: a u32 count followed by count encoded values.
+func decodePrimArgs(data []byte) ([]any, error) {
+	if len(data) < 4 {
+		return nil, errTruncated
+	}
+	count := int(binary.LittleEndian.Uint32(data))
+	off := 4
+	args := make([]any, count)
+	for i := 0; i < count; i++ {
+		var err error
+		off, err = unmarshalInto(data, off, reflect.ValueOf(&args[i]).Elem())
+		if err != nil {
+			return nil, err
+		}
+	}
+	return args, nil
+}
+
+// decodeOwnProperties decodes the buffer produced by qjs_own_properties: a
+// u32 count, then per property a u32 key length and key bytes, followed by
+// the encoded value when withValues is set. values is nil otherwise.
+func decodeOwnProperties(data []byte, withValues bool) (keys []string, values []any, err error) {
+	if len(data) < 4 {
+		return nil, nil, errTruncated
+	}
+	count := int(binary.LittleEndian.Uint32(data))
+	off := 4
+	keys = make([]string, count)
+	if withValues {
+		values = make([]any, count)
+	}
+	for i := 0; i < count; i++ {
+		if off+4 > len(data) {
+			return nil, nil, errTruncated
+		}
+		n := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		if off+n > len(data) {
+			return nil, nil, errTruncated
+		}
+		keys[i] = string(data[off : off+n])
+		off += n
+		if withValues {
+			off, err = unmarshalInto(data, off, reflect.ValueOf(&values[i]).Elem())
+			if err != nil {
+				return nil, nil, err
+			}
+		}
+	}
+	if off != len(data) {
+		return nil, nil, errors.New("trailing data in property list")
+	}
+	return keys, values, nil
+}
+
+// encodePrimResult encodes a callback result for the eager-marshal return
+// path. nil (including unmarshalable values) encodes as undefined, which the
+// C side represents as an empty response.
+func encodePrimResult(v any) []byte {
+	if v == nil {
+		return nil
+	}
+	buf, err := appendMarshal(nil, reflect.ValueOf(v))
+	if err != nil {
+		return nil
+	}
+	return buf
+}
+
+// skipValue advances past one encoded value without decoding it.
+func skipValue(data []byte, off int) (int, error) {
+	if off >= len(data) {
+		return 0, errTruncated
+	}
+	tag := data[off]
+	off++
+
+	switch tag {
+	case marshalUndefined, marshalNull, marshalFalse, marshalTrue:
+		return off, nil
+	case marshalInt32:
+		return off + 4, boundsCheck(data, off+4)
+	case marshalFloat64:
+		return off + 8, boundsCheck(data, off+8)
+	case marshalString:
+		if off+4 > len(data) {
+			return 0, errTruncated
+		}
+		n := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4 + n
+		return off, boundsCheck(data, off)
+	case marshalArray:
+		if off+4 > len(data) {
+			return 0, errTruncated
+		}
+		count := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		for i := 0; i < count; i++ {
+			var err error
+			off, err = skipValue(data, off)
+			if err != nil {
+				return 0, err
+			}
+		}
+		return off, nil
+	case marshalObject:
+		if off+4 > len(data) {
+			return 0, errTruncated
+		}
+		count := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		for i := 0; i < count; i++ {
+			if off+4 > len(data) {
+				return 0, errTruncated
+			}
+			n := int(binary.LittleEndian.Uint32(data[off:]))
+			off += 4 + n
+			if err := boundsCheck(data, off); err != nil {
+				return 0, err
+			}
+			var err error
+			off, err = skipValue(data, off)
+			if err != nil {
+				return 0, err
+			}
+		}
+		return off, nil
+	default:
+		return 0, fmt.Errorf("bad tag %d in encoded value", tag)
+	}
+}
+
+func boundsCheck(data []byte, off int) error {
+	if off > len(data) {
+		return errTruncated
+	}
+	return nil
+}
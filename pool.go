@@ -0,0 +1,208 @@
+package quickjs
+
+import (
+	"context"
+	"errors"
+	"fmt"
+	"sync"
+)
+
+// RuntimePool keeps a fixed number of warm runtimes, each with its own
+// pre-instantiated WASM module, so request-scoped isolation does not pay
+// the full NewRuntime cost (wazero instantiation, WASI setup) on every
+// request. Acquire hands out a warm runtime and Release recycles it by
+// resetting the JS runtime and slot/arena state inside the same WASM
+// instance.
+//
+// Usage:
+//
+//	pool, err := quickjs.NewRuntimePool(4)
+//	...
+//	rt, err := pool.Acquire()
+//	defer pool.Release(rt)
+type RuntimePool struct {
+	goCtx  context.Context
+	idle   chan *Runtime
+	mu     sync.Mutex
+	closed bool
+}
+
+// NewRuntimePool creates a pool with size pre-warmed runtimes.
+func NewRuntimePool(size int) (*RuntimePool, error) {
+	return NewRuntimePoolWithContext(context.Background(), size)
+}
+
+// NewRuntimePoolWithContext creates a pool with size pre-warmed runtimes
+// using the given context for all WASM operations.
+func NewRuntimePoolWithContext(ctx context.Context, size int) (*RuntimePool, error) {
+	if size <= 0 {
+		return nil, errors.New("runtime pool size must be positive")
+	}
+
+	p := &RuntimePool{
+		goCtx: ctx,
+		idle:  make(chan *Runtime, size),
+	}
+	for i := 0; i < size; i++ {
+		rt, err := NewRuntimeWithContext(ctx)
+		if err != nil {
+			_ = p.Close()
+			return nil, fmt.Errorf("failed to warm runtime pool: %w", err)
+		}
+		p.idle <- rt
+	}
+	return p, nil
+}
+
+// Acquire returns a warm, isolated runtime, blocking until one is available.
+// The runtime must be returned with Release when the request is done.
+func (p *RuntimePool) Acquire() (*Runtime, error) {
+	rt, ok := <-p.idle
+	if !ok {
+		return nil, errors.New("runtime pool is closed")
+	}
+	return rt, nil
+}
+
+// Release recycles a runtime back into the pool. The runtime's JS state is
+// torn down and rebuilt inside the existing WASM instance, so any contexts
+// or values created from it are invalid after this call. If the reset fails
+// the broken runtime is closed and replaced with a fresh one so the pool
+// keeps its size.
+func (p *RuntimePool) Release(rt *Runtime) error {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+	if p.closed {
+		return rt.Close()
+	}
+
+	if err := rt.reset(); err != nil {
+		_ = rt.Close()
+		replacement, newErr := NewRuntimeWithContext(p.goCtx)
+		if newErr != nil {
+			return fmt.Errorf("failed to replace broken runtime: %w", newErr)
+		}
+		p.idle <- replacement
+		return err
+	}
+
+	p.idle <- rt
+	return nil
+}
+
+// Close shuts down the pool and all idle runtimes. Runtimes currently
+// acquired are closed when released.
+func (p *RuntimePool) Close() error {
+	p.mu.Lock()
+	if p.closed {
+		p.mu.Unlock()
+		return nil
+	}
+	p.closed = true
+	p.mu.Unlock()
+
+	close(p.idle)
+	var firstErr error
+	for rt := range p.idle {
+		if err := rt.Close(); err != nil && firstErr == nil {
+			firstErr = err
+		}
+	}
+	return firstErr
+}
+
+// ContextPool keeps a fixed number of contexts on one runtime and recycles
+// them with Context.Reset instead of a Close/NewContext cycle, skipping the
+// intrinsic re-initialization that dominates per-request context cost.
+// Where RuntimePool buys isolation between requests, ContextPool buys
+// throughput within one trusted runtime: all pooled contexts share the
+// runtime's heap and mutex.
+//
+// Usage:
+//
+//	pool, err := rt.NewContextPool(8)
+//	...
+//	ctx, err := pool.Acquire()
+//	defer pool.Release(ctx)
+type ContextPool struct {
+	rt     *Runtime
+	idle   chan *Context
+	mu     sync.Mutex
+	closed bool
+}
+
+// NewContextPool creates a pool with size pre-built contexts on the runtime.
+func (r *Runtime) NewContextPool(size int) (*ContextPool, error) {
+	if size <= 0 {
+		return nil, errors.New("context pool size must be positive")
+	}
+
+	p := &ContextPool{
+		rt:   r,
+		idle: make(chan *Context, size),
+	}
+	for i := 0; i < size; i++ {
+		ctx, err := r.NewContext()
+		if err != nil {
+			_ = p.Close()
+			return nil, fmt.Errorf("failed to warm context pool: %w", err)
+		}
+		p.idle <- ctx
+	}
+	return p, nil
+}
+
+// Acquire returns a reset context, blocking until one is available. The
+// context must be returned with Release when the request is done.
+func (p *ContextPool) Acquire() (*Context, error) {
+	ctx, ok := <-p.idle
+	if !ok {
+		return nil, errors.New("context pool is closed")
+	}
+	return ctx, nil
+}
+
+// Release recycles a context back into the pool after deleting the globals
+// the request added. If the reset fails the broken context is closed and
+// replaced with a fresh one so the pool keeps its size.
+func (p *ContextPool) Release(ctx *Context) error {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+	if p.closed {
+		return ctx.Close()
+	}
+
+	if err := ctx.Reset(); err != nil {
+		_ = ctx.Close()
+		replacement, newErr := p.rt.NewContext()
+		if newErr != nil {
+			return fmt.Errorf("failed to replace broken context: %w", newErr)
+		}
+		p.idle <- replacement
+		return err
+	}
+
+	p.idle <- ctx
+	return nil
+}
+
+// Close shuts down the pool and all idle contexts. Contexts currently
+// acquired are closed when released.
+func (p *ContextPool) Close() error {
+	p.mu.Lock()
+	if p.closed {
+		p.mu.Unlock()
+		return nil
+	}
+	p.closed = true
+	p.mu.Unlock()
+
+	close(p.idle)
+	var firstErr error
+	for ctx := range p.idle {
+		if err := ctx.Close(); err != nil && firstErr == nil {
+			firstErr = err
+		}
+	}
+	return firstErr
+}
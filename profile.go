@@ -0,0 +1,100 @@
+package quickjs
+
+import (
+	"encoding/binary"
+	"errors"
+	"sort"
+)
+
+// ProfileEntry is one function's share of a sampling profile.
+type ProfileEntry struct {
+	Name         string
+	SelfSamples  uint64 // samples with this function on top of the stack
+	TotalSamples uint64 // samples with this function anywhere on the stack
+}
+
+// Profile is the result of a sampling run. Samples are taken by the
+// interpreter's interrupt hook at a fixed opcode interval, so a function's
+// share of Samples approximates its share of CPU time for bytecode-bound
+// workloads. Functions is sorted by SelfSamples, descending.
+type Profile struct {
+	Samples   uint64 // total samples taken, including ones outside JS frames
+	Dropped   uint64 // samples discarded because the function table was full
+	Functions []ProfileEntry
+}
+
+// StartProfile arms the sampling profiler for this context. Only one
+// profile can run per process at a time (the sampler state lives in the
+// WASM module); a second StartProfile before StopProfile fails.
+func (c *Context) StartProfile() error {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	ok, err := c.runtime.bridge.ProfileStart(c.runtime.goCtx, c.ctxPtr)
+	if err != nil {
+		return err
+	}
+	if !ok {
+		return errors.New("a profile is already running")
+	}
+	return nil
+}
+
+// StopProfile disarms the profiler and returns the samples collected since
+// StartProfile.
+func (c *Context) StopProfile() (Profile, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	data, err := c.runtime.bridge.ProfileStop(c.runtime.goCtx, c.ctxPtr)
+	if err != nil {
+		return Profile{}, err
+	}
+	if data == nil {
+		return Profile{}, errors.New("no profile is running")
+	}
+	return parseProfile(data)
+}
+
+// parseProfile decodes the report serialized by qjs_profile_stop:
+// u64 samples, u64 dropped, u32 entry count, then per entry
+// u32 name length + name bytes, u64 self, u64 total.
+func parseProfile(data []byte) (Profile, error) {
+	if len(data) < 20 {
+		return Profile{}, errors.New("truncated profile report")
+	}
+	p := Profile{
+		Samples: binary.LittleEndian.Uint64(data[0:]),
+		Dropped: binary.LittleEndian.Uint64(data[8:]),
+	}
+	count := int(binary.LittleEndian.Uint32(data[16:]))
+	off := 20
+
+	p.Functions = make([]ProfileEntry, 0, count)
+	for i := 0; i < count; i++ {
+		if off+4 > len(data) {
+			return Profile{}, errors.New("truncated profile report")
+		}
+		nameLen := int(binary.LittleEndian.Uint32(data[off:]))
+		off += 4
+		if off+nameLen+16 > len(data) {
+			return Profile{}, errors.New("truncated profile report")
+		}
+		name := string(data[off : off+nameLen])
+		off += nameLen
+		if name == "" {
+			name = "(anonymous)"
+		}
+		p.Functions = append(p.Functions, ProfileEntry{
+			Name:         name,
+			SelfSamples:  binary.LittleEndian.Uint64(data[off:]),
+			TotalSamples: binary.LittleEndian.Uint64(data[off+8:]),
+		})
+		off += 16
+	}
+
+	sort.Slice(p.Functions, func(i, j int) bool {
+		return p.Functions[i].SelfSamples > p.Functions[j].SelfSamples
+	})
+	return p, nil
+}
@@ -28,10 +28,14 @@ package quickjs
 
 import (
 	"context"
+	"encoding/binary"
 	"errors"
 	"fmt"
+	"io"
+	"math"
 	"runtime"
 	"sync"
+	"time"
 
 	"github.com/Gaurav-Gosain/quickjs/internal/bridge"
 )
@@ -57,6 +61,27 @@ type Runtime struct {
 	mu      sync.Mutex
 	logFunc func(msg string)
 
+	// Linear-memory address of the interrupt flag, fetched lazily by
+	// interruptFlag. The address is a module static, so it survives reset.
+	interruptPtr uint32
+
+	// GC pause accounting, maintained by RunGC and reported by MemoryUsage.
+	// Guarded by the runtime mutex.
+	gcRuns       uint64
+	gcLastPause  time.Duration
+	gcTotalPause time.Duration
+
+	// Idle GC scheduler state, guarded by gcMu. gcStop is non-nil while the
+	// background goroutine is running.
+	gcMu   sync.Mutex
+	gcStop chan struct{}
+	gcWG   sync.WaitGroup
+
+	// Event loop state, guarded by loopMu. loop is non-nil while Serve is
+	// running.
+	loopMu sync.Mutex
+	loop   *eventLoop
+
 	// For reentrant callback support: track which goroutine holds the lock
 	lockHolder uintptr    // goroutine ID of current lock holder (0 if unlocked)
 	lockDepth  int32      // recursion depth
@@ -85,6 +110,20 @@ func (r *Runtime) lock() {
 	r.lockMu.Unlock()
 }
 
+// tryLock acquires the runtime mutex only if it is immediately available.
+// Used by the idle GC scheduler so background work never delays a request
+// that is already waiting on the lock.
+func (r *Runtime) tryLock() bool {
+	if !r.mu.TryLock() {
+		return false
+	}
+	r.lockMu.Lock()
+	r.lockHolder = getGoroutineID()
+	r.lockDepth = 1
+	r.lockMu.Unlock()
+	return true
+}
+
 // unlock releases the runtime mutex.
 func (r *Runtime) unlock() {
 	r.lockMu.Lock()
@@ -117,6 +156,16 @@ func NewRuntime() (*Runtime, error) {
 	return NewRuntimeWithContext(context.Background())
 }
 
+// WithCompilationCacheDir backs the WASM compilation cache with a directory
+// and pre-compiles the embedded engine into it. By default the cache is
+// in-memory, so every new process re-JITs the whole WASM binary before its
+// first eval; with a persistent cache, restarted processes load the compiled
+// machine code from disk instead. Call once at startup, before creating any
+// Runtime.
+func WithCompilationCacheDir(dir string) error {
+	return bridge.SetCompilationCacheDir(context.Background(), dir)
+}
+
 // NewRuntimeWithContext creates a new JavaScript runtime with the given context.
 func NewRuntimeWithContext(ctx context.Context) (*Runtime, error) {
 	b, err := bridge.New(ctx)
@@ -141,6 +190,9 @@ func NewRuntimeWithContext(ctx context.Context) (*Runtime, error) {
 
 // Close releases all resources associated with the runtime.
 func (r *Runtime) Close() error {
+	// Stop the idle GC goroutine before tearing down the engine it collects.
+	r.DisableIdleGC()
+
 	r.lock()
 	defer r.unlock()
 	if err := r.bridge.FreeRuntime(r.goCtx, r.rtPtr); err != nil {
@@ -149,6 +201,35 @@ func (r *Runtime) Close() error {
 	return r.bridge.Close(r.goCtx)
 }
 
+// reset tears down the JS runtime plus the slot/arena state inside the
+// existing WASM instance and creates a fresh JS runtime. This skips the
+// expensive module re-instantiation that NewRuntime pays, so it is the
+// cheap path used when recycling runtimes through a RuntimePool.
+// All contexts and values created from the old runtime become invalid.
+func (r *Runtime) reset() error {
+	r.lock()
+	defer r.unlock()
+
+	if err := r.bridge.FreeRuntime(r.goCtx, r.rtPtr); err != nil {
+		return err
+	}
+	// The slot table held JSValues owned by the freed runtime; the arena only
+	// ever holds transient data. Both can be reclaimed wholesale now.
+	if err := r.bridge.ResetSlots(r.goCtx); err != nil {
+		return err
+	}
+	if err := r.bridge.ResetHeap(r.goCtx); err != nil {
+		return err
+	}
+
+	rtPtr, err := r.bridge.NewRuntime(r.goCtx)
+	if err != nil {
+		return err
+	}
+	r.rtPtr = rtPtr
+	return nil
+}
+
 // SetLogFunc sets the function called for console.log output from JavaScript.
 func (r *Runtime) SetLogFunc(fn func(msg string)) {
 	r.lock()
@@ -173,9 +254,17 @@ func (r *Runtime) NewContext() (*Context, error) {
 		return nil, fmt.Errorf("failed to add console support: %w", err)
 	}
 
+	// Snapshot the post-intrinsics global set so Reset can later delete
+	// everything added on top of it instead of rebuilding the context.
+	if err := r.bridge.ContextBaseline(r.goCtx, ctxPtr); err != nil {
+		_ = r.bridge.FreeContext(r.goCtx, ctxPtr)
+		return nil, fmt.Errorf("failed to snapshot context baseline: %w", err)
+	}
+
 	return &Context{
 		runtime: r,
 		ctxPtr:  ctxPtr,
+		atoms:   make(map[string]uint32),
 	}, nil
 }
 
@@ -183,7 +272,154 @@ func (r *Runtime) NewContext() (*Context, error) {
 func (r *Runtime) RunGC() error {
 	r.lock()
 	defer r.unlock()
-	return r.bridge.RunGC(r.goCtx, r.rtPtr)
+	return r.runGCLocked()
+}
+
+// runGCLocked runs a collection and updates the pause counters.
+// Caller must hold the mutex.
+func (r *Runtime) runGCLocked() error {
+	start := time.Now()
+	err := r.bridge.RunGC(r.goCtx, r.rtPtr)
+	pause := time.Since(start)
+	r.gcRuns++
+	r.gcLastPause = pause
+	r.gcTotalPause += pause
+	return err
+}
+
+// SetGCThreshold sets the allocation volume (in bytes) after which the
+// engine triggers its own collection mid-execution. Raise it when using
+// EnableIdleGC so pauses move to idle points instead of landing inside
+// request handling.
+func (r *Runtime) SetGCThreshold(threshold uint32) error {
+	r.lock()
+	defer r.unlock()
+	return r.bridge.SetGCThreshold(r.goCtx, r.rtPtr, threshold)
+}
+
+// SetMemoryWatermark arms a soft memory limit: when the engine's malloc
+// counter crosses bytes, fn is called once with a fresh memory snapshot —
+// a chance to run GC, shed load, or snapshot state before a hard
+// SetMemoryLimit failure would kill the context. The check rides the
+// interrupt handler (every few thousand opcodes), so well-behaved scripts
+// pay nothing. fn runs on the goroutine executing JavaScript, mid-eval;
+// runtime operations (RunGC, MemoryUsage) are safe there, but it must not
+// block. One-shot: call SetMemoryWatermark again to re-arm after handling.
+// bytes 0 (or a nil fn) disarms.
+func (r *Runtime) SetMemoryWatermark(bytes uint64, fn func(stats MemoryStats)) error {
+	r.lock()
+	defer r.unlock()
+
+	if bytes == 0 || fn == nil {
+		r.bridge.SetWatermarkFunc(nil)
+		return r.bridge.SetMemoryWatermark(r.goCtx, r.rtPtr, 0)
+	}
+	r.bridge.SetWatermarkFunc(func(rtPtr uint32, usedBytes uint64) {
+		stats, err := r.MemoryUsage()
+		if err != nil {
+			stats = MemoryStats{MallocSize: int64(usedBytes)}
+		}
+		fn(stats)
+	})
+	return r.bridge.SetMemoryWatermark(r.goCtx, r.rtPtr, bytes)
+}
+
+// EnableIdleGC starts a background goroutine that attempts a collection
+// every interval, but only when the runtime lock is uncontended — if any
+// request holds (or is waiting for) the lock, the cycle is skipped rather
+// than stalling it. Pauses are accounted in MemoryUsage like RunGC calls.
+// Stopped by DisableIdleGC or Close.
+func (r *Runtime) EnableIdleGC(interval time.Duration) {
+	r.gcMu.Lock()
+	defer r.gcMu.Unlock()
+	if r.gcStop != nil {
+		return // already running
+	}
+	stop := make(chan struct{})
+	r.gcStop = stop
+	r.gcWG.Add(1)
+	go r.idleGCLoop(stop, interval)
+}
+
+// DisableIdleGC stops the background GC goroutine started by EnableIdleGC
+// and waits for any in-flight collection to finish.
+func (r *Runtime) DisableIdleGC() {
+	r.gcMu.Lock()
+	stop := r.gcStop
+	r.gcStop = nil
+	r.gcMu.Unlock()
+	if stop == nil {
+		return
+	}
+	close(stop)
+	r.gcWG.Wait()
+}
+
+func (r *Runtime) idleGCLoop(stop chan struct{}, interval time.Duration) {
+	defer r.gcWG.Done()
+	ticker := time.NewTicker(interval)
+	defer ticker.Stop()
+	for {
+		select {
+		case <-stop:
+			return
+		case <-ticker.C:
+			if !r.tryLock() {
+				continue // runtime busy; collect on a later cycle
+			}
+			r.runGCLocked()
+			r.unlock()
+		}
+	}
+}
+
+// MemoryStats is a snapshot of the engine's internal memory accounting
+// (JS_ComputeMemoryUsage) plus the GC pause counters maintained by RunGC.
+// Schedulers can watch MallocSize to evict heavy tenants before the WASM
+// linear memory has to grow.
+type MemoryStats struct {
+	MallocSize     int64 // bytes currently allocated by the engine
+	MallocLimit    int64 // limit set via SetMemoryLimit (-1 = none)
+	MemoryUsedSize int64
+	MallocCount    int64 // live allocations
+	AtomCount      int64
+	AtomSize       int64
+	StringCount    int64
+	StringSize     int64
+	ObjectCount    int64
+	ObjectSize     int64
+	BytecodeSize   int64 // compiled JS function code
+
+	GCRuns       uint64        // completed RunGC invocations
+	GCLastPause  time.Duration // duration of the most recent RunGC
+	GCTotalPause time.Duration // cumulative time spent in RunGC
+}
+
+// MemoryUsage returns current engine memory statistics for the runtime.
+func (r *Runtime) MemoryUsage() (MemoryStats, error) {
+	r.lock()
+	defer r.unlock()
+
+	raw, err := r.bridge.ComputeMemoryUsage(r.goCtx, r.rtPtr)
+	if err != nil {
+		return MemoryStats{}, err
+	}
+	return MemoryStats{
+		MallocSize:     raw[0],
+		MallocLimit:    raw[1],
+		MemoryUsedSize: raw[2],
+		MallocCount:    raw[3],
+		AtomCount:      raw[4],
+		AtomSize:       raw[5],
+		StringCount:    raw[6],
+		StringSize:     raw[7],
+		ObjectCount:    raw[8],
+		ObjectSize:     raw[9],
+		BytecodeSize:   raw[10],
+		GCRuns:         r.gcRuns,
+		GCLastPause:    r.gcLastPause,
+		GCTotalPause:   r.gcTotalPause,
+	}, nil
 }
 
 // ExecutePendingJobs executes pending promise jobs.
@@ -195,6 +431,66 @@ func (r *Runtime) ExecutePendingJobs() (int, error) {
 	return int(n), err
 }
 
+// SetModuleLoader installs fn as the loader for import specifiers, so code
+// run with EvalModule can import further modules instead of being a single
+// pre-bundled string. fn returns the module source for a specifier. Each
+// resolved module's compiled form is cached per runtime keyed by specifier,
+// so shared libraries are parsed once; later contexts (and repeat imports)
+// deserialize the cached bytecode instead of reparsing.
+func (r *Runtime) SetModuleLoader(fn func(specifier string) (string, error)) error {
+	r.lock()
+	defer r.unlock()
+	r.bridge.SetModuleLoader(fn)
+	return r.bridge.EnableModuleLoader(r.goCtx, r.rtPtr)
+}
+
+// StaleHandleCount reports how many operations presented a Value whose
+// underlying slot had already been recycled — a use-after-free on the Go
+// side. Such accesses read as undefined instead of aliasing the slot's new
+// occupant; a non-zero count means some code holds Values past their
+// lifetime.
+func (r *Runtime) StaleHandleCount() (uint32, error) {
+	r.lock()
+	defer r.unlock()
+	return r.bridge.StaleHandleCount(r.goCtx)
+}
+
+// PrecompileRegex compiles the given patterns into the process-wide regex
+// bytecode cache, which js_compile_regexp consults before invoking
+// libregexp. Compiled patterns normally die with their context; after a
+// warm-up call, every context in the process (including ones on other
+// runtimes) reuses the cached bytecode instead of recompiling. Patterns
+// use no flags; pattern variants with flags are cached on first natural
+// use instead. Returns an error naming the first invalid pattern.
+func (r *Runtime) PrecompileRegex(patterns []string) error {
+	ctx, err := r.NewContext()
+	if err != nil {
+		return err
+	}
+	defer ctx.Close()
+
+	r.lock()
+	defer r.unlock()
+	for _, pattern := range patterns {
+		ok, err := r.bridge.PrecompileRegexp(r.goCtx, ctx.ctxPtr, pattern, "")
+		if err != nil {
+			return err
+		}
+		if !ok {
+			return fmt.Errorf("invalid regex pattern %q", pattern)
+		}
+	}
+	return nil
+}
+
+// RegexCacheStats reports cumulative hits and misses of the process-wide
+// regex compilation cache.
+func (r *Runtime) RegexCacheStats() (hits, misses uint64, err error) {
+	r.lock()
+	defer r.unlock()
+	return r.bridge.RegexpCacheStats(r.goCtx)
+}
+
 // SetMemoryLimit sets the memory limit for the runtime in bytes.
 func (r *Runtime) SetMemoryLimit(limit uint32) error {
 	r.lock()
@@ -213,15 +509,59 @@ func (r *Runtime) SetMaxStackSize(size uint32) error {
 type Context struct {
 	runtime *Runtime
 	ctxPtr  uint32
+
+	// Interned property-name atoms, so repeated Get/Set with the same few
+	// names become a uint32 lookup instead of a string copy and UTF-8
+	// decode per access. Guarded by the runtime mutex.
+	atoms map[string]uint32
+}
+
+// maxInternedAtoms caps the per-context atom cache so pathological
+// workloads with unbounded dynamic property names cannot grow it forever.
+// Past the cap, accesses fall back to the string-based path.
+const maxInternedAtoms = 4096
+
+// internAtom returns the interned atom for a property name, interning it on
+// first use. Returns 0 if the name cannot be interned (cache full or
+// context closed); callers then use the string-based accessors.
+// Caller must hold the mutex.
+func (c *Context) internAtom(name string) uint32 {
+	if atom, ok := c.atoms[name]; ok {
+		return atom
+	}
+	if c.atoms == nil || len(c.atoms) >= maxInternedAtoms {
+		return 0
+	}
+	atom, err := c.runtime.bridge.NewAtom(c.runtime.goCtx, c.ctxPtr, name)
+	if err != nil || atom == 0 {
+		return 0
+	}
+	c.atoms[name] = atom
+	return atom
 }
 
 // Close releases all resources associated with the context.
 func (c *Context) Close() error {
 	c.runtime.lock()
 	defer c.runtime.unlock()
+	for _, atom := range c.atoms {
+		_ = c.runtime.bridge.FreeAtom(c.runtime.goCtx, c.ctxPtr, atom)
+	}
+	c.atoms = nil
 	return c.runtime.bridge.FreeContext(c.runtime.goCtx, c.ctxPtr)
 }
 
+// Reset deletes every global property added since the context was created
+// and clears any pending exception, returning the context to a like-new
+// state without paying JS_NewContext's intrinsic re-initialization. This is
+// what makes pooled contexts (NewContextPool) cheap to recycle between
+// requests.
+func (c *Context) Reset() error {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+	return c.runtime.bridge.ContextReset(c.runtime.goCtx, c.ctxPtr)
+}
+
 // Eval evaluates JavaScript code and returns the result.
 func (c *Context) Eval(code string) (Value, error) {
 	return c.EvalFile(code, "<eval>")
@@ -240,6 +580,124 @@ func (c *Context) EvalFile(code, filename string) (Value, error) {
 	return c.checkException(valPtr)
 }
 
+// EvalPrimitive evaluates JavaScript code and returns primitive results as
+// plain Go values — nil (undefined/null), bool, int64, or float64 — in a
+// single boundary crossing with no slot-table traffic. Eval needs a slot
+// store plus further crossings to type-check, extract, and free even a
+// bare number, which adds up for workloads that evaluate millions of
+// boolean/number expressions. Non-primitive results (objects, arrays,
+// strings, functions) fall back to a regular slot-backed Value.
+func (c *Context) EvalPrimitive(code string) (any, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	res, err := c.runtime.bridge.EvalPrim(c.runtime.goCtx, c.ctxPtr, code, "<eval>", int32(EvalGlobal))
+	if err != nil {
+		return nil, err
+	}
+	return c.primValue(res)
+}
+
+// primValue decodes the tagged union from EvalPrim/CallPrim into a Go
+// value, matching the marshal layer's conventions (int32 widens to int64).
+// Caller must hold the mutex.
+func (c *Context) primValue(res bridge.PrimResult) (any, error) {
+	switch res.Tag {
+	case bridge.PrimUndefined, bridge.PrimNull:
+		return nil, nil
+	case bridge.PrimBool:
+		return res.Payload != 0, nil
+	case bridge.PrimInt32:
+		return int64(int32(uint32(res.Payload))), nil
+	case bridge.PrimFloat64:
+		return math.Float64frombits(res.Payload), nil
+	case bridge.PrimHandle:
+		return Value{ctx: c, ptr: uint32(res.Payload)}, nil
+	case bridge.PrimException:
+		return nil, c.pendingError()
+	}
+	return nil, fmt.Errorf("unknown primitive result tag %d", res.Tag)
+}
+
+// EvalWithDeadline evaluates JavaScript code, interrupting it if it runs
+// longer than timeout. The deadline is enforced by the engine's interrupt
+// handler, which reads a flag in WASM linear memory that a Go timer sets
+// directly — the interpreter loop never crosses the host boundary to check
+// it, so well-behaved scripts pay essentially nothing. An interrupted
+// script (e.g. while(true){}) returns an error.
+func (c *Context) EvalWithDeadline(code string, timeout time.Duration) (Value, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	flagPtr, err := c.runtime.interruptFlag()
+	if err != nil {
+		return Value{}, err
+	}
+	if err := c.runtime.bridge.InstallInterruptHandler(c.runtime.goCtx, c.runtime.rtPtr); err != nil {
+		return Value{}, err
+	}
+
+	// done lets us order the lock-free flag writes: Stop() reports false as
+	// soon as the timer has expired, possibly before the AfterFunc goroutine
+	// has run. Clearing the flag at that point would race with its pending
+	// write of true, which would then leak into (and spuriously abort) the
+	// next eval on this runtime. Waiting on done makes the clear below
+	// always the last write.
+	done := make(chan struct{})
+	timer := time.AfterFunc(timeout, func() {
+		c.runtime.bridge.SetInterruptFlag(flagPtr, true)
+		close(done)
+	})
+	valPtr, err := c.runtime.bridge.Eval(c.runtime.goCtx, c.ctxPtr, code, "<eval>", int32(EvalGlobal))
+	interrupted := !timer.Stop()
+	if interrupted {
+		<-done
+	}
+	c.runtime.bridge.SetInterruptFlag(flagPtr, false)
+	if err != nil {
+		return Value{}, err
+	}
+
+	val, evalErr := c.checkException(valPtr)
+	if evalErr != nil && interrupted {
+		return Value{}, fmt.Errorf("evaluation interrupted: deadline of %v exceeded", timeout)
+	}
+	return val, evalErr
+}
+
+// interruptFlag returns the linear-memory address of the module's interrupt
+// flag, fetching it on first use. Caller must hold the mutex.
+func (r *Runtime) interruptFlag() (uint32, error) {
+	if r.interruptPtr == 0 {
+		ptr, err := r.bridge.InterruptFlagPtr(r.goCtx)
+		if err != nil {
+			return 0, err
+		}
+		r.interruptPtr = ptr
+	}
+	return r.interruptPtr, nil
+}
+
+// EvalReader evaluates a script streamed from r, with no upper size limit.
+// Eval stages the whole script through a fixed-size arena in WASM memory;
+// EvalReader instead uploads it in chunks into engine-allocated memory and
+// parses once the upload completes, so multi-megabyte generated scripts
+// neither overflow the arena nor need a second full copy in Go.
+func (c *Context) EvalReader(r io.Reader, filename string) (Value, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	if filename == "" {
+		filename = "<eval>"
+	}
+	valPtr, err := c.runtime.bridge.EvalStream(c.runtime.goCtx, c.ctxPtr, r, 0, filename, int32(EvalGlobal))
+	if err != nil {
+		return Value{}, err
+	}
+
+	return c.checkException(valPtr)
+}
+
 // EvalModule evaluates JavaScript code as an ES6 module.
 func (c *Context) EvalModule(code, filename string) (Value, error) {
 	c.runtime.lock()
@@ -258,18 +716,67 @@ func (c *Context) EvalModule(code, filename string) (Value, error) {
 func (c *Context) checkException(valPtr uint32) (Value, error) {
 	isExc, _ := c.runtime.bridge.IsException(c.runtime.goCtx, valPtr)
 	if isExc {
-		// Get the actual exception
-		excPtr, _ := c.runtime.bridge.GetException(c.runtime.goCtx, c.ctxPtr)
-		errMsg, _ := c.runtime.bridge.GetErrorMessage(c.runtime.goCtx, c.ctxPtr, excPtr)
-		if errMsg == "" {
-			errMsg = "JavaScript exception"
-		}
-		_ = c.runtime.bridge.FreeValue(c.runtime.goCtx, c.ctxPtr, excPtr)
-		return Value{}, errors.New(errMsg)
+		return Value{}, c.pendingError()
 	}
 	return Value{ctx: c, ptr: valPtr}, nil
 }
 
+// pendingError consumes the pending exception in the context and returns it
+// as a Go error. Caller must hold the mutex.
+func (c *Context) pendingError() error {
+	excPtr, _ := c.runtime.bridge.GetException(c.runtime.goCtx, c.ctxPtr)
+	errMsg, _ := c.runtime.bridge.GetErrorMessage(c.runtime.goCtx, c.ctxPtr, excPtr)
+	if errMsg == "" {
+		errMsg = "JavaScript exception"
+	}
+	_ = c.runtime.bridge.FreeValue(c.runtime.goCtx, c.ctxPtr, excPtr)
+	return errors.New(errMsg)
+}
+
+// Compile compiles JavaScript code to engine bytecode without executing it.
+// The bytecode can be cached (e.g. at deploy time) and executed many times
+// with EvalBytecode, skipping the parser entirely on the hot path. Bytecode
+// is only portable across the same engine version.
+func (c *Context) Compile(code string) ([]byte, error) {
+	return c.CompileFile(code, "<compile>")
+}
+
+// CompileFile compiles JavaScript code with a specified filename for error messages.
+func (c *Context) CompileFile(code, filename string) ([]byte, error) {
+	return c.compile(code, filename, EvalGlobal)
+}
+
+// CompileModule compiles JavaScript code as an ES6 module.
+func (c *Context) CompileModule(code, filename string) ([]byte, error) {
+	return c.compile(code, filename, EvalModule)
+}
+
+func (c *Context) compile(code, filename string, flags EvalFlag) ([]byte, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	bytecode, err := c.runtime.bridge.Compile(c.runtime.goCtx, c.ctxPtr, code, filename, int32(flags))
+	if err != nil {
+		return nil, err
+	}
+	if bytecode == nil {
+		return nil, c.pendingError()
+	}
+	return bytecode, nil
+}
+
+// EvalBytecode executes bytecode previously produced by Compile.
+func (c *Context) EvalBytecode(bytecode []byte) (Value, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	valPtr, err := c.runtime.bridge.EvalBytecode(c.runtime.goCtx, c.ctxPtr, bytecode)
+	if err != nil {
+		return Value{}, err
+	}
+	return c.checkException(valPtr)
+}
+
 // Global returns the global object.
 func (c *Context) Global() (Value, error) {
 	c.runtime.lock()
@@ -387,6 +894,61 @@ func (c *Context) ArrayBuffer(data []byte) Value {
 	return Value{ctx: c, ptr: ptr}
 }
 
+// ArrayBufferExternal creates a JavaScript ArrayBuffer of the given size and
+// returns a byte slice aliasing its backing store in WASM linear memory, so
+// Go can fill it in place without the staging copy ArrayBuffer makes. The
+// slice starts zeroed. It is only valid until the next operation on this
+// runtime (engine allocations may grow WASM memory, which relocates it), so
+// write the data before touching the runtime again.
+func (c *Context) ArrayBufferExternal(size int) (Value, []byte, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	valPtr, dataPtr, err := c.runtime.bridge.NewUninitArrayBuffer(c.runtime.goCtx, c.ctxPtr, uint32(size))
+	if err != nil {
+		return Value{}, nil, err
+	}
+	val, err := c.checkException(valPtr)
+	if err != nil {
+		return Value{}, nil, err
+	}
+	view, err := c.runtime.bridge.MemoryView(dataPtr, uint32(size))
+	if err != nil {
+		return Value{}, nil, err
+	}
+	return val, view, nil
+}
+
+// Float64Array creates a JavaScript Float64Array from a Go slice. The
+// packed element data moves in a single Memory.Write instead of one
+// crossing per element, so million-element vectors transfer at memcpy
+// speed.
+func (c *Context) Float64Array(data []float64) Value {
+	buf := make([]byte, 8*len(data))
+	for i, f := range data {
+		binary.LittleEndian.PutUint64(buf[8*i:], math.Float64bits(f))
+	}
+
+	c.runtime.lock()
+	defer c.runtime.unlock()
+	ptr, _ := c.runtime.bridge.NewTypedArray(c.runtime.goCtx, c.ctxPtr, bridge.TypedArrayFloat64, buf)
+	return Value{ctx: c, ptr: ptr}
+}
+
+// Int32Array creates a JavaScript Int32Array from a Go slice with a single
+// bulk copy of the element data.
+func (c *Context) Int32Array(data []int32) Value {
+	buf := make([]byte, 4*len(data))
+	for i, n := range data {
+		binary.LittleEndian.PutUint32(buf[4*i:], uint32(n))
+	}
+
+	c.runtime.lock()
+	defer c.runtime.unlock()
+	ptr, _ := c.runtime.bridge.NewTypedArray(c.runtime.goCtx, c.ctxPtr, bridge.TypedArrayInt32, buf)
+	return Value{ctx: c, ptr: ptr}
+}
+
 // ParseJSON parses a JSON string and returns the result.
 func (c *Context) ParseJSON(json string) (Value, error) {
 	c.runtime.lock()
@@ -399,6 +961,20 @@ func (c *Context) ParseJSON(json string) (Value, error) {
 	return c.checkException(valPtr)
 }
 
+// ParseJSONBytes parses a JSON document directly from a byte slice. Unlike
+// ParseJSON it skips the []byte-to-string conversion, so documents read
+// from the network or disk go straight into WASM memory.
+func (c *Context) ParseJSONBytes(data []byte) (Value, error) {
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	valPtr, err := c.runtime.bridge.JSONParseBytes(c.runtime.goCtx, c.ctxPtr, data)
+	if err != nil {
+		return Value{}, err
+	}
+	return c.checkException(valPtr)
+}
+
 // ============================================================================
 // Go Function Binding
 // ============================================================================
@@ -436,6 +1012,44 @@ func (c *Context) Function(name string, fn GoFunc) Value {
 	return Value{ctx: c, ptr: ptr}
 }
 
+// GoFuncFast is the signature for eagerly-marshaled Go callbacks. Arguments
+// arrive as plain Go values following Unmarshal's rules for any (int64,
+// float64, string, bool, nil, []any, map[string]any) and the return value
+// is encoded back following Marshal's rules; return nil for undefined.
+type GoFuncFast func(args []any) any
+
+// FastFunction creates a JavaScript function whose arguments and result are
+// batched through a single marshal buffer per direction. Where Function
+// costs a WASM crossing per argument plus one per Value inspection, a
+// FastFunction call costs two regardless of arity — the right choice for
+// hot callbacks that only exchange primitives and plain data. The callback
+// has no access to live Values; use Function when identity or mutation of
+// engine objects matters.
+func (c *Context) FastFunction(name string, fn GoFuncFast) Value {
+	// Runs while the mutex is already held by Eval; it works purely on the
+	// decoded Go values, so no bridge calls are needed here.
+	bridgeFn := func(ctxPtr uint32, data []byte) []byte {
+		args, err := decodePrimArgs(data)
+		if err != nil {
+			return nil
+		}
+		return encodePrimResult(fn(args))
+	}
+
+	funcID := c.runtime.bridge.RegisterGoFuncPrim(bridgeFn)
+
+	c.runtime.lock()
+	defer c.runtime.unlock()
+
+	ptr, err := c.runtime.bridge.NewCFunctionPrim(c.runtime.goCtx, c.ctxPtr, funcID, name, -1)
+	if err != nil {
+		c.runtime.bridge.UnregisterGoFunc(funcID)
+		return c.undefinedUnlocked()
+	}
+
+	return Value{ctx: c, ptr: ptr}
+}
+
 // SetGlobal sets a value on the global object.
 func (c *Context) SetGlobal(name string, val Value) error {
 	c.runtime.lock()
@@ -633,6 +1247,78 @@ func (v Value) IsPromise() bool {
 	return result
 }
 
+// Await blocks until the promise settles and returns its fulfillment value,
+// or the rejection reason as an error. Pending jobs are pumped one at a
+// time with the runtime mutex released between pumps, so other goroutines
+// sharing the Runtime can make progress while the promise is outstanding
+// (e.g. waiting on a resolver driven from Go). Awaiting a non-promise
+// value returns it unchanged. Cancel ctx to stop waiting.
+func (v Value) Await(ctx context.Context) (Value, error) {
+	if v.ctx == nil {
+		return Value{}, errors.New("cannot await nil value")
+	}
+	rt := v.ctx.runtime
+
+	for {
+		if err := ctx.Err(); err != nil {
+			return Value{}, err
+		}
+
+		rt.lock()
+		state, err := rt.bridge.PromiseState(rt.goCtx, v.ctx.ctxPtr, v.ptr)
+		if err != nil {
+			rt.unlock()
+			return Value{}, err
+		}
+
+		switch state {
+		case -1: // not a promise
+			rt.unlock()
+			return v, nil
+
+		case 1: // fulfilled
+			resultPtr, err := rt.bridge.PromiseResult(rt.goCtx, v.ctx.ctxPtr, v.ptr)
+			rt.unlock()
+			if err != nil {
+				return Value{}, err
+			}
+			return Value{ctx: v.ctx, ptr: resultPtr}, nil
+
+		case 2: // rejected
+			resultPtr, err := rt.bridge.PromiseResult(rt.goCtx, v.ctx.ctxPtr, v.ptr)
+			if err != nil {
+				rt.unlock()
+				return Value{}, err
+			}
+			errMsg, _ := rt.bridge.GetErrorMessage(rt.goCtx, v.ctx.ctxPtr, resultPtr)
+			_ = rt.bridge.FreeValue(rt.goCtx, v.ctx.ctxPtr, resultPtr)
+			rt.unlock()
+			if errMsg == "" {
+				errMsg = "promise rejected"
+			}
+			return Value{}, errors.New(errMsg)
+		}
+
+		// Pending: run at most one job, then drop the lock so other
+		// goroutines can interleave. A negative result means the job threw;
+		// the failure surfaces through the promise state on the next pass.
+		ran, err := rt.bridge.ExecutePendingJob(rt.goCtx, rt.rtPtr)
+		rt.unlock()
+		if err != nil {
+			return Value{}, err
+		}
+		if ran == 0 {
+			// Queue is empty but the promise is still pending, so it is
+			// waiting on an external resolver. Back off briefly.
+			select {
+			case <-ctx.Done():
+				return Value{}, ctx.Err()
+			case <-time.After(time.Millisecond):
+			}
+		}
+	}
+}
+
 // ============================================================================
 // Value Conversion
 // ============================================================================
@@ -709,6 +1395,31 @@ func (v Value) JSONStringify() (string, error) {
 	return v.ctx.runtime.bridge.JSONStringify(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
 }
 
+// AppendJSON serializes the value as JSON and appends the bytes to dst,
+// returning the extended slice. Unlike JSONStringify there is no
+// intermediate string value or Go string allocation per document: the
+// engine serializes once and the bytes are copied straight out of WASM
+// memory into dst. Reusing dst across documents amortizes the Go-side
+// allocation to zero.
+func (v Value) AppendJSON(dst []byte) ([]byte, error) {
+	if v.ctx == nil {
+		return dst, errors.New("nil value")
+	}
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+
+	view, release, err := v.ctx.runtime.bridge.JSONStringifyView(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
+	if err != nil {
+		return dst, err
+	}
+	if view == nil {
+		return dst, v.ctx.pendingError()
+	}
+	dst = append(dst, view...)
+	release()
+	return dst, nil
+}
+
 // Bytes returns the value as bytes (for ArrayBuffer values).
 func (v Value) Bytes() ([]byte, error) {
 	if v.ctx == nil {
@@ -719,6 +1430,104 @@ func (v Value) Bytes() ([]byte, error) {
 	return v.ctx.runtime.bridge.GetArrayBuffer(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
 }
 
+// BytesView returns the ArrayBuffer contents as a slice aliasing WASM linear
+// memory, avoiding the copy that Bytes makes — useful for multi-megabyte
+// buffers. The buffer is pinned (reference-counted) until the returned
+// release function is called; release must be called exactly once. The view
+// is invalidated by any operation on this runtime that allocates inside the
+// engine (WASM memory growth relocates it), so read or write the data before
+// touching the runtime again.
+func (v Value) BytesView() ([]byte, func(), error) {
+	if v.ctx == nil {
+		return nil, nil, errors.New("nil value")
+	}
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+
+	// Pin the buffer so the JS side cannot free it under the view.
+	pinPtr, err := v.ctx.runtime.bridge.DupValue(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	bufPtr, length, err := v.ctx.runtime.bridge.GetArrayBufferRegion(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
+	if err != nil {
+		_ = v.ctx.runtime.bridge.FreeValue(v.ctx.runtime.goCtx, v.ctx.ctxPtr, pinPtr)
+		return nil, nil, err
+	}
+	view, err := v.ctx.runtime.bridge.MemoryView(bufPtr, length)
+	if err != nil {
+		_ = v.ctx.runtime.bridge.FreeValue(v.ctx.runtime.goCtx, v.ctx.ctxPtr, pinPtr)
+		return nil, nil, err
+	}
+
+	ctx := v.ctx
+	release := func() {
+		ctx.runtime.lock()
+		defer ctx.runtime.unlock()
+		_ = ctx.runtime.bridge.FreeValue(ctx.runtime.goCtx, ctx.ctxPtr, pinPtr)
+	}
+	return view, release, nil
+}
+
+// typedArrayView returns a view of a typed array's packed element data,
+// verifying the element type. The view aliases WASM linear memory and is
+// only valid until the next engine operation, so callers decode it before
+// releasing the mutex. Caller must hold the mutex.
+func (v Value) typedArrayView(wantType int32) ([]byte, error) {
+	dataPtr, byteLen, _, arrayType, ok, err := v.ctx.runtime.bridge.GetTypedArrayInfo(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
+	if err != nil {
+		return nil, err
+	}
+	if !ok {
+		return nil, errors.New("value is not a typed array")
+	}
+	if arrayType != wantType {
+		return nil, fmt.Errorf("typed array has element type %d, want %d", arrayType, wantType)
+	}
+	return v.ctx.runtime.bridge.MemoryView(dataPtr, byteLen)
+}
+
+// Float64s returns the contents of a Float64Array as a Go slice. The
+// packed element data is read with a single copy out of linear memory.
+func (v Value) Float64s() ([]float64, error) {
+	if v.ctx == nil {
+		return nil, errors.New("nil value")
+	}
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+
+	view, err := v.typedArrayView(bridge.TypedArrayFloat64)
+	if err != nil {
+		return nil, err
+	}
+	out := make([]float64, len(view)/8)
+	for i := range out {
+		out[i] = math.Float64frombits(binary.LittleEndian.Uint64(view[8*i:]))
+	}
+	return out, nil
+}
+
+// Int32s returns the contents of an Int32Array as a Go slice with a single
+// bulk copy of the element data.
+func (v Value) Int32s() ([]int32, error) {
+	if v.ctx == nil {
+		return nil, errors.New("nil value")
+	}
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+
+	view, err := v.typedArrayView(bridge.TypedArrayInt32)
+	if err != nil {
+		return nil, err
+	}
+	out := make([]int32, len(view)/4)
+	for i := range out {
+		out[i] = int32(binary.LittleEndian.Uint32(view[4*i:]))
+	}
+	return out, nil
+}
+
 // Typeof returns the JavaScript typeof string for the value.
 func (v Value) Typeof() string {
 	if v.ctx == nil {
@@ -741,7 +1550,13 @@ func (v Value) Get(prop string) (Value, error) {
 	}
 	v.ctx.runtime.lock()
 	defer v.ctx.runtime.unlock()
-	valPtr, err := v.ctx.runtime.bridge.GetProperty(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, prop)
+	var valPtr uint32
+	var err error
+	if atom := v.ctx.internAtom(prop); atom != 0 {
+		valPtr, err = v.ctx.runtime.bridge.GetPropertyAtom(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, atom)
+	} else {
+		valPtr, err = v.ctx.runtime.bridge.GetProperty(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, prop)
+	}
 	if err != nil {
 		return Value{}, err
 	}
@@ -755,9 +1570,104 @@ func (v Value) Set(prop string, val Value) error {
 	}
 	v.ctx.runtime.lock()
 	defer v.ctx.runtime.unlock()
+	if atom := v.ctx.internAtom(prop); atom != 0 {
+		return v.ctx.runtime.bridge.SetPropertyAtom(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, atom, val.ptr)
+	}
 	return v.ctx.runtime.bridge.SetProperty(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, prop, val.ptr)
 }
 
+// GetAll returns the given properties in input order using a single WASM
+// crossing, instead of one crossing per property as with repeated Get calls.
+// Missing properties come back as undefined, matching Get.
+func (v Value) GetAll(props []string) ([]Value, error) {
+	if v.ctx == nil {
+		return nil, errors.New("nil value")
+	}
+	if len(props) == 0 {
+		return nil, nil
+	}
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+
+	valPtrs, err := v.ctx.runtime.bridge.GetProperties(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, props)
+	if err != nil {
+		return nil, err
+	}
+	values := make([]Value, len(valPtrs))
+	for i, ptr := range valPtrs {
+		values[i] = Value{ctx: v.ctx, ptr: ptr}
+	}
+	return values, nil
+}
+
+// SetAll sets all given properties using a single WASM crossing.
+func (v Value) SetAll(props map[string]Value) error {
+	if v.ctx == nil {
+		return errors.New("nil value")
+	}
+	if len(props) == 0 {
+		return nil
+	}
+	names := make([]string, 0, len(props))
+	valPtrs := make([]uint32, 0, len(props))
+	for name, val := range props {
+		names = append(names, name)
+		valPtrs = append(valPtrs, val.ptr)
+	}
+
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+	return v.ctx.runtime.bridge.SetProperties(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, names, valPtrs)
+}
+
+// Keys returns the object's own enumerable property names in one WASM
+// crossing, in property order — the batched equivalent of evaluating
+// Object.keys(v) and reading the result element by element.
+func (v Value) Keys() ([]string, error) {
+	keys, _, err := v.ownProperties(false)
+	return keys, err
+}
+
+// Entry is one key/value pair returned by Entries, in the object's own
+// property order. Values follow Unmarshal's rules for any (int64, float64,
+// string, bool, nil, []any, map[string]any).
+type Entry struct {
+	Key   string
+	Value any
+}
+
+// Entries returns the object's own enumerable properties with their values
+// decoded into Go, all in one WASM crossing. Unlike Unmarshal into a map it
+// preserves property order; unlike repeated Get calls it never materializes
+// intermediate Values.
+func (v Value) Entries() ([]Entry, error) {
+	keys, values, err := v.ownProperties(true)
+	if err != nil {
+		return nil, err
+	}
+	entries := make([]Entry, len(keys))
+	for i, key := range keys {
+		entries[i] = Entry{Key: key, Value: values[i]}
+	}
+	return entries, nil
+}
+
+func (v Value) ownProperties(withValues bool) ([]string, []any, error) {
+	if v.ctx == nil {
+		return nil, nil, errors.New("nil value")
+	}
+	v.ctx.runtime.lock()
+	data, err := v.ctx.runtime.bridge.OwnProperties(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, withValues)
+	v.ctx.runtime.unlock()
+	if err != nil {
+		return nil, nil, err
+	}
+	if data == nil {
+		return nil, nil, errors.New("value is not an object")
+	}
+	return decodeOwnProperties(data, withValues)
+}
+
 // Has returns true if the object has the given property.
 func (v Value) Has(prop string) bool {
 	if v.ctx == nil {
@@ -843,6 +1753,28 @@ func (v Value) Call(this Value, args ...Value) (Value, error) {
 	return v.ctx.checkException(resultPtr)
 }
 
+// CallPrimitive calls the value as a function, returning primitive results
+// as plain Go values (see Context.EvalPrimitive) in a single boundary
+// crossing. Non-primitive results fall back to a regular slot-backed Value.
+func (v Value) CallPrimitive(this Value, args ...Value) (any, error) {
+	if v.ctx == nil {
+		return nil, errors.New("nil value")
+	}
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+
+	argPtrs := make([]uint32, len(args))
+	for i, arg := range args {
+		argPtrs[i] = arg.ptr
+	}
+
+	res, err := v.ctx.runtime.bridge.CallPrim(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, this.ptr, argPtrs)
+	if err != nil {
+		return nil, err
+	}
+	return v.ctx.primValue(res)
+}
+
 // CallMethod calls a method on the value with the given arguments.
 func (v Value) CallMethod(method string, args ...Value) (Value, error) {
 	if v.ctx == nil {
@@ -864,6 +1796,102 @@ func (v Value) CallMethod(method string, args ...Value) (Value, error) {
 	return v.ctx.checkException(resultPtr)
 }
 
+// BoundMethod is a method resolved once by Bind: receiver and function are
+// both pinned in the slot table, so Call goes straight to the engine's call
+// export with no per-invocation property lookup.
+type BoundMethod struct {
+	ctx     *Context
+	thisPtr uint32
+	fnPtr   uint32
+}
+
+// Bind resolves a method by name once and returns a BoundMethod whose Call
+// skips the lookup. Where CallMethod pays a property lookup (name copy,
+// UTF-8 decode, atom hash) plus the call crossing on every invocation, a
+// bound method pays only the call — the right shape for hot loops invoking
+// the same few methods repeatedly. Release the binding when done.
+func (v Value) Bind(method string) (BoundMethod, error) {
+	if v.ctx == nil {
+		return BoundMethod{}, errors.New("nil value")
+	}
+	v.ctx.runtime.lock()
+	defer v.ctx.runtime.unlock()
+
+	var fnPtr uint32
+	var err error
+	if atom := v.ctx.internAtom(method); atom != 0 {
+		fnPtr, err = v.ctx.runtime.bridge.GetPropertyAtom(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, atom)
+	} else {
+		fnPtr, err = v.ctx.runtime.bridge.GetProperty(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr, method)
+	}
+	if err != nil {
+		return BoundMethod{}, err
+	}
+	isFn, err := v.ctx.runtime.bridge.IsFunction(v.ctx.runtime.goCtx, v.ctx.ctxPtr, fnPtr)
+	if err != nil {
+		return BoundMethod{}, err
+	}
+	if !isFn {
+		_ = v.ctx.runtime.bridge.FreeValue(v.ctx.runtime.goCtx, v.ctx.ctxPtr, fnPtr)
+		return BoundMethod{}, fmt.Errorf("%q is not a function", method)
+	}
+	return BoundMethod{ctx: v.ctx, thisPtr: v.ptr, fnPtr: fnPtr}, nil
+}
+
+// Call invokes the bound method on its pinned receiver.
+func (m BoundMethod) Call(args ...Value) (Value, error) {
+	if m.ctx == nil {
+		return Value{}, errors.New("nil bound method")
+	}
+	m.ctx.runtime.lock()
+	defer m.ctx.runtime.unlock()
+
+	argPtrs := make([]uint32, len(args))
+	for i, arg := range args {
+		argPtrs[i] = arg.ptr
+	}
+
+	resultPtr, err := m.ctx.runtime.bridge.Call(m.ctx.runtime.goCtx, m.ctx.ctxPtr, m.fnPtr, m.thisPtr, argPtrs)
+	if err != nil {
+		return Value{}, err
+	}
+	return m.ctx.checkException(resultPtr)
+}
+
+// CallPrimitive calls the bound method, returning primitive results as
+// plain Go values (see Context.EvalPrimitive). Combined with Bind this is
+// the cheapest repeated-call path: no property lookup and, for boolean or
+// number results, no slot traffic.
+func (m BoundMethod) CallPrimitive(args ...Value) (any, error) {
+	if m.ctx == nil {
+		return nil, errors.New("nil bound method")
+	}
+	m.ctx.runtime.lock()
+	defer m.ctx.runtime.unlock()
+
+	argPtrs := make([]uint32, len(args))
+	for i, arg := range args {
+		argPtrs[i] = arg.ptr
+	}
+
+	res, err := m.ctx.runtime.bridge.CallPrim(m.ctx.runtime.goCtx, m.ctx.ctxPtr, m.fnPtr, m.thisPtr, argPtrs)
+	if err != nil {
+		return nil, err
+	}
+	return m.ctx.primValue(res)
+}
+
+// Release frees the pinned function slot. The receiver's slot belongs to
+// the Value the method was bound from and is left alone.
+func (m BoundMethod) Release() {
+	if m.ctx == nil {
+		return
+	}
+	m.ctx.runtime.lock()
+	defer m.ctx.runtime.unlock()
+	_ = m.ctx.runtime.bridge.FreeValue(m.ctx.runtime.goCtx, m.ctx.ctxPtr, m.fnPtr)
+}
+
 // New calls the value as a constructor with the given arguments.
 func (v Value) New(args ...Value) (Value, error) {
 	if v.ctx == nil {
@@ -1,10 +1,13 @@
 package quickjs
 
 import (
+	"context"
+	"errors"
 	"fmt"
 	"strings"
 	"sync"
 	"testing"
+	"time"
 )
 
 func TestNewRuntime(t *testing.T) {
@@ -2189,6 +2192,2485 @@ func TestRaceGoCallback(t *testing.T) {
 	}
 }
 
+// ============================================================================
+// Runtime Pool
+// ============================================================================
+
+func TestRuntimePool(t *testing.T) {
+	pool, err := NewRuntimePool(2)
+	if err != nil {
+		t.Fatalf("NewRuntimePool() error = %v", err)
+	}
+	defer pool.Close()
+
+	rt, err := pool.Acquire()
+	if err != nil {
+		t.Fatalf("Acquire() error = %v", err)
+	}
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+
+	result, err := ctx.Eval("var pooled = 42; pooled")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	if result.String() != "42" {
+		t.Errorf("result = %q, want %q", result.String(), "42")
+	}
+	ctx.Close()
+
+	if err := pool.Release(rt); err != nil {
+		t.Fatalf("Release() error = %v", err)
+	}
+
+	// A recycled runtime must not see state from the previous request.
+	rt2, err := pool.Acquire()
+	if err != nil {
+		t.Fatalf("Acquire() error = %v", err)
+	}
+	ctx2, err := rt2.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	result, err = ctx2.Eval("typeof pooled")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	if result.String() != "undefined" {
+		t.Errorf("recycled runtime leaked state: typeof pooled = %q", result.String())
+	}
+	ctx2.Close()
+	pool.Release(rt2)
+}
+
+func TestRuntimePoolConcurrent(t *testing.T) {
+	pool, err := NewRuntimePool(4)
+	if err != nil {
+		t.Fatalf("NewRuntimePool() error = %v", err)
+	}
+	defer pool.Close()
+
+	var wg sync.WaitGroup
+	for i := range 16 {
+		wg.Add(1)
+		go func(id int) {
+			defer wg.Done()
+
+			rt, err := pool.Acquire()
+			if err != nil {
+				t.Errorf("Goroutine %d: Acquire error: %v", id, err)
+				return
+			}
+			defer pool.Release(rt)
+
+			ctx, err := rt.NewContext()
+			if err != nil {
+				t.Errorf("Goroutine %d: NewContext error: %v", id, err)
+				return
+			}
+			defer ctx.Close()
+
+			result, err := ctx.Eval(fmt.Sprintf("%d * 2", id))
+			if err != nil {
+				t.Errorf("Goroutine %d: Eval error: %v", id, err)
+				return
+			}
+			if result.String() != fmt.Sprintf("%d", id*2) {
+				t.Errorf("Goroutine %d: result = %q", id, result.String())
+			}
+		}(i)
+	}
+	wg.Wait()
+}
+
+// ============================================================================
+// Precompiled Bytecode
+// ============================================================================
+
+func TestCompileAndEvalBytecode(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	bytecode, err := ctx.Compile("function add(a, b) { return a + b; } add(20, 22)")
+	if err != nil {
+		t.Fatalf("Compile() error = %v", err)
+	}
+	if len(bytecode) == 0 {
+		t.Fatal("Compile() returned empty bytecode")
+	}
+
+	// Compile once, eval many: the same bytecode must be reusable.
+	for i := 0; i < 3; i++ {
+		result, err := ctx.EvalBytecode(bytecode)
+		if err != nil {
+			t.Fatalf("EvalBytecode() error = %v", err)
+		}
+		if result.String() != "42" {
+			t.Errorf("EvalBytecode() = %q, want %q", result.String(), "42")
+		}
+	}
+}
+
+func TestCompileSyntaxError(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	_, err = ctx.Compile("function {")
+	if err == nil {
+		t.Fatal("Compile() of invalid code should return error")
+	}
+}
+
+func TestCompileBytecodeInFreshContext(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+
+	bytecode, err := ctx.Compile("1 + 2")
+	if err != nil {
+		t.Fatalf("Compile() error = %v", err)
+	}
+	ctx.Close()
+
+	// Bytecode must be evaluable in a context other than the compiling one.
+	ctx2, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx2.Close()
+
+	result, err := ctx2.EvalBytecode(bytecode)
+	if err != nil {
+		t.Fatalf("EvalBytecode() error = %v", err)
+	}
+	if result.String() != "3" {
+		t.Errorf("EvalBytecode() = %q, want %q", result.String(), "3")
+	}
+}
+
+// ============================================================================
+// Snapshot / Restore
+// ============================================================================
+
+func TestSnapshotRestore(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	// Simulate expensive warm-up work.
+	_, err = ctx.Eval("var config = { loaded: true }; function compute(x) { return x * 3; }")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	blob, err := rt.Snapshot(ctx)
+	if err != nil {
+		t.Fatalf("Snapshot() error = %v", err)
+	}
+
+	rt2, ctxs, err := NewRuntimeFromSnapshot(blob)
+	if err != nil {
+		t.Fatalf("NewRuntimeFromSnapshot() error = %v", err)
+	}
+	defer rt2.Close()
+	if len(ctxs) != 1 {
+		t.Fatalf("restored %d contexts, want 1", len(ctxs))
+	}
+
+	result, err := ctxs[0].Eval("compute(14) + (config.loaded ? 0 : 100)")
+	if err != nil {
+		t.Fatalf("Eval on restored context error = %v", err)
+	}
+	if result.String() != "42" {
+		t.Errorf("restored context result = %q, want %q", result.String(), "42")
+	}
+}
+
+func TestSnapshotInvalidBlob(t *testing.T) {
+	_, _, err := NewRuntimeFromSnapshot([]byte("not a snapshot"))
+	if err == nil {
+		t.Fatal("NewRuntimeFromSnapshot() of garbage should return error")
+	}
+}
+
+// ============================================================================
+// Batched Property Operations
+// ============================================================================
+
+func TestValueGetAll(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	obj, err := ctx.Eval(`({ id: 7, name: "batch", active: true })`)
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	values, err := obj.GetAll([]string{"id", "name", "active", "missing"})
+	if err != nil {
+		t.Fatalf("GetAll() error = %v", err)
+	}
+	if len(values) != 4 {
+		t.Fatalf("GetAll() returned %d values, want 4", len(values))
+	}
+	if values[0].String() != "7" {
+		t.Errorf("id = %q, want %q", values[0].String(), "7")
+	}
+	if values[1].String() != "batch" {
+		t.Errorf("name = %q, want %q", values[1].String(), "batch")
+	}
+	if !values[2].Bool() {
+		t.Error("active = false, want true")
+	}
+	if !values[3].IsUndefined() {
+		t.Error("missing property should be undefined")
+	}
+}
+
+func TestValueSetAll(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	obj := ctx.Object()
+	err = obj.SetAll(map[string]Value{
+		"x":    ctx.Int32(10),
+		"y":    ctx.Int32(32),
+		"name": ctx.String("point"),
+	})
+	if err != nil {
+		t.Fatalf("SetAll() error = %v", err)
+	}
+
+	if err := ctx.SetGlobal("p", obj); err != nil {
+		t.Fatalf("SetGlobal error = %v", err)
+	}
+	result, err := ctx.Eval("p.x + p.y")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	if result.String() != "42" {
+		t.Errorf("p.x + p.y = %q, want %q", result.String(), "42")
+	}
+}
+
+// ============================================================================
+// Zero-Copy ArrayBuffer Views
+// ============================================================================
+
+func TestBytesView(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	buf, err := ctx.Eval("new Uint8Array([1, 2, 3, 4]).buffer")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	view, release, err := buf.BytesView()
+	if err != nil {
+		t.Fatalf("BytesView() error = %v", err)
+	}
+	if len(view) != 4 {
+		t.Fatalf("view length = %d, want 4", len(view))
+	}
+	for i, want := range []byte{1, 2, 3, 4} {
+		if view[i] != want {
+			t.Errorf("view[%d] = %d, want %d", i, view[i], want)
+		}
+	}
+	release()
+}
+
+func TestArrayBufferExternal(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	val, view, err := ctx.ArrayBufferExternal(4)
+	if err != nil {
+		t.Fatalf("ArrayBufferExternal() error = %v", err)
+	}
+	// Fill the backing store directly from Go.
+	copy(view, []byte{10, 20, 30, 40})
+
+	if err := ctx.SetGlobal("buf", val); err != nil {
+		t.Fatalf("SetGlobal error = %v", err)
+	}
+	result, err := ctx.Eval("new Uint8Array(buf).reduce((a, b) => a + b, 0)")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	if result.String() != "100" {
+		t.Errorf("sum = %q, want %q", result.String(), "100")
+	}
+}
+
+// ============================================================================
+// Direct Struct Marshaling
+// ============================================================================
+
+func TestMarshalRoundTrip(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	type point struct {
+		X    int     `json:"x"`
+		Y    float64 `json:"y"`
+		Name string  `json:"name"`
+		Tags []string
+	}
+
+	val, err := ctx.Marshal(point{X: 3, Y: 1.5, Name: "origin", Tags: []string{"a", "b"}})
+	if err != nil {
+		t.Fatalf("Marshal() error = %v", err)
+	}
+	if err := ctx.SetGlobal("p", val); err != nil {
+		t.Fatalf("SetGlobal error = %v", err)
+	}
+	result, err := ctx.Eval("p.x + '/' + p.y + '/' + p.name + '/' + p.Tags.join(',')")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	if result.String() != "3/1.5/origin/a,b" {
+		t.Errorf("marshaled value = %q, want %q", result.String(), "3/1.5/origin/a,b")
+	}
+}
+
+func TestUnmarshalStruct(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	val, err := ctx.Eval(`({x: 7, y: 2.5, name: "pt", extra: true, nested: {depth: 2}})`)
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	var out struct {
+		X      int     `json:"x"`
+		Y      float64 `json:"y"`
+		Name   string  `json:"name"`
+		Nested struct {
+			Depth int `json:"depth"`
+		} `json:"nested"`
+	}
+	if err := val.Unmarshal(&out); err != nil {
+		t.Fatalf("Unmarshal() error = %v", err)
+	}
+	if out.X != 7 || out.Y != 2.5 || out.Name != "pt" || out.Nested.Depth != 2 {
+		t.Errorf("Unmarshal() = %+v", out)
+	}
+}
+
+func TestUnmarshalAny(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	val, err := ctx.Eval(`([1, "two", null, {ok: true}])`)
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	var out any
+	if err := val.Unmarshal(&out); err != nil {
+		t.Fatalf("Unmarshal() error = %v", err)
+	}
+	arr, ok := out.([]any)
+	if !ok || len(arr) != 4 {
+		t.Fatalf("Unmarshal() = %#v, want 4-element slice", out)
+	}
+	if arr[0] != int64(1) || arr[1] != "two" || arr[2] != nil {
+		t.Errorf("elements = %#v", arr[:3])
+	}
+	obj, ok := arr[3].(map[string]any)
+	if !ok || obj["ok"] != true {
+		t.Errorf("object element = %#v", arr[3])
+	}
+
+	if err := val.Unmarshal(out); err == nil {
+		t.Error("Unmarshal(non-pointer) expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Promise Await
+// ============================================================================
+
+func TestAwaitFulfilled(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	val, err := ctx.Eval("Promise.resolve(1).then(x => x + 41)")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	result, err := val.Await(context.Background())
+	if err != nil {
+		t.Fatalf("Await() error = %v", err)
+	}
+	if result.String() != "42" {
+		t.Errorf("Await() = %q, want %q", result.String(), "42")
+	}
+}
+
+func TestAwaitRejected(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	val, err := ctx.Eval(`Promise.reject(new Error("boom"))`)
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	if _, err := val.Await(context.Background()); err == nil {
+		t.Error("Await() expected error for rejected promise, got nil")
+	} else if !strings.Contains(err.Error(), "boom") {
+		t.Errorf("Await() error = %v, want rejection reason", err)
+	}
+}
+
+func TestAwaitNonPromise(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	val, err := ctx.Eval("5")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	result, err := val.Await(context.Background())
+	if err != nil {
+		t.Fatalf("Await() error = %v", err)
+	}
+	if result.String() != "5" {
+		t.Errorf("Await() = %q, want %q", result.String(), "5")
+	}
+}
+
+// ============================================================================
+// Eval Deadlines
+// ============================================================================
+
+func TestEvalWithDeadlineInterrupts(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	start := time.Now()
+	_, err = ctx.EvalWithDeadline("while (true) {}", 50*time.Millisecond)
+	if err == nil {
+		t.Fatal("EvalWithDeadline() expected error for infinite loop, got nil")
+	}
+	if elapsed := time.Since(start); elapsed > 5*time.Second {
+		t.Errorf("EvalWithDeadline() took %v, interrupt did not fire promptly", elapsed)
+	}
+}
+
+func TestEvalWithDeadlineCompletes(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	result, err := ctx.EvalWithDeadline("6 * 7", time.Second)
+	if err != nil {
+		t.Fatalf("EvalWithDeadline() error = %v", err)
+	}
+	if result.String() != "42" {
+		t.Errorf("EvalWithDeadline() = %q, want %q", result.String(), "42")
+	}
+
+	// The runtime must remain usable after an interrupt.
+	if _, err := ctx.EvalWithDeadline("while (true) {}", 20*time.Millisecond); err == nil {
+		t.Fatal("EvalWithDeadline() expected error for infinite loop, got nil")
+	}
+	result, err = ctx.Eval("1 + 1")
+	if err != nil {
+		t.Fatalf("Eval after interrupt error = %v", err)
+	}
+	if result.String() != "2" {
+		t.Errorf("Eval after interrupt = %q, want %q", result.String(), "2")
+	}
+}
+
+// ============================================================================
+// Compilation Cache
+// ============================================================================
+
+func TestWithCompilationCacheDirAfterRuntime(t *testing.T) {
+	// Force the in-memory cache to exist first; switching to a directory
+	// cache afterwards must be rejected, not silently ignored.
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	rt.Close()
+
+	if err := WithCompilationCacheDir(t.TempDir()); err == nil {
+		t.Error("WithCompilationCacheDir() after NewRuntime expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Atom Interning
+// ============================================================================
+
+func TestInternedPropertyAccess(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	obj, err := ctx.Eval("({})")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	// Repeated accesses of the same name exercise the interned-atom path.
+	for i := 0; i < 100; i++ {
+		num := ctx.Int32(int32(i))
+		if err := obj.Set("counter", num); err != nil {
+			t.Fatalf("Set error = %v", err)
+		}
+		got, err := obj.Get("counter")
+		if err != nil {
+			t.Fatalf("Get error = %v", err)
+		}
+		if n, _ := got.Int32(); n != int32(i) {
+			t.Fatalf("Get(counter) = %d, want %d", n, i)
+		}
+	}
+	if len(ctx.atoms) != 1 {
+		t.Errorf("atom cache size = %d, want 1", len(ctx.atoms))
+	}
+}
+
+// ============================================================================
+// Parallel Executor
+// ============================================================================
+
+func TestExecutorEval(t *testing.T) {
+	ex, err := NewExecutor(2)
+	if err != nil {
+		t.Fatalf("NewExecutor() error = %v", err)
+	}
+	defer ex.Close()
+
+	result, err := ex.Eval("6 * 7")
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if result != int64(42) {
+		t.Errorf("Eval() = %#v, want int64(42)", result)
+	}
+}
+
+func TestExecutorParallel(t *testing.T) {
+	ex, err := NewExecutor(4)
+	if err != nil {
+		t.Fatalf("NewExecutor() error = %v", err)
+	}
+	defer ex.Close()
+
+	var wg sync.WaitGroup
+	errs := make([]error, 32)
+	for i := 0; i < 32; i++ {
+		wg.Add(1)
+		go func(i int) {
+			defer wg.Done()
+			result, err := ex.Eval(fmt.Sprintf("%d * 2", i))
+			if err != nil {
+				errs[i] = err
+				return
+			}
+			if result != int64(i*2) {
+				errs[i] = fmt.Errorf("got %#v, want %d", result, i*2)
+			}
+		}(i)
+	}
+	wg.Wait()
+	for i, err := range errs {
+		if err != nil {
+			t.Errorf("job %d: %v", i, err)
+		}
+	}
+}
+
+func TestExecutorClosed(t *testing.T) {
+	ex, err := NewExecutor(1)
+	if err != nil {
+		t.Fatalf("NewExecutor() error = %v", err)
+	}
+	ex.Close()
+
+	if _, err := ex.Eval("1"); err == nil {
+		t.Error("Eval() on closed executor expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Fast-Path JSON
+// ============================================================================
+
+func TestParseJSONBytesAndAppendJSON(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	doc := []byte(`{"id":7,"payload":[1,2,3],"name":"événement"}`)
+	val, err := ctx.ParseJSONBytes(doc)
+	if err != nil {
+		t.Fatalf("ParseJSONBytes() error = %v", err)
+	}
+
+	out, err := val.AppendJSON(nil)
+	if err != nil {
+		t.Fatalf("AppendJSON() error = %v", err)
+	}
+	if string(out) != string(doc) {
+		t.Errorf("AppendJSON() = %s, want %s", out, doc)
+	}
+
+	// Appending must extend dst, not replace it.
+	out2, err := val.AppendJSON([]byte("prefix:"))
+	if err != nil {
+		t.Fatalf("AppendJSON(prefix) error = %v", err)
+	}
+	if string(out2) != "prefix:"+string(doc) {
+		t.Errorf("AppendJSON(prefix) = %s", out2)
+	}
+
+	if _, err := ctx.ParseJSONBytes([]byte("{not json")); err == nil {
+		t.Error("ParseJSONBytes() expected error for invalid JSON, got nil")
+	}
+}
+
+// ============================================================================
+// Slot Table Generations
+// ============================================================================
+
+func TestStaleHandleDetection(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	val, err := ctx.Eval(`"alive"`)
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	before, err := rt.StaleHandleCount()
+	if err != nil {
+		t.Fatalf("StaleHandleCount() error = %v", err)
+	}
+
+	// Free the slot behind the value, then recycle it: the stale handle
+	// must read as undefined, not alias the slot's new occupant.
+	if err := rt.bridge.FreeValue(rt.goCtx, ctx.ctxPtr, val.ptr); err != nil {
+		t.Fatalf("FreeValue error = %v", err)
+	}
+	if _, err := ctx.Eval(`"recycled"`); err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+
+	if got := val.String(); got != "undefined" {
+		t.Errorf("stale value read = %q, want %q", got, "undefined")
+	}
+	after, err := rt.StaleHandleCount()
+	if err != nil {
+		t.Fatalf("StaleHandleCount() error = %v", err)
+	}
+	if after <= before {
+		t.Errorf("StaleHandleCount() = %d, want > %d", after, before)
+	}
+}
+
+// ============================================================================
+// Memory Telemetry
+// ============================================================================
+
+func TestMemoryUsage(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	before, err := rt.MemoryUsage()
+	if err != nil {
+		t.Fatalf("MemoryUsage() error = %v", err)
+	}
+	if before.MallocSize <= 0 || before.MallocCount <= 0 {
+		t.Errorf("MemoryUsage() = %+v, want positive malloc stats", before)
+	}
+
+	if _, err := ctx.Eval("globalThis.big = new Array(10000).fill('x'.repeat(100))"); err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	after, err := rt.MemoryUsage()
+	if err != nil {
+		t.Fatalf("MemoryUsage() error = %v", err)
+	}
+	if after.MallocSize <= before.MallocSize {
+		t.Errorf("MallocSize did not grow: before %d, after %d", before.MallocSize, after.MallocSize)
+	}
+
+	if err := rt.RunGC(); err != nil {
+		t.Fatalf("RunGC() error = %v", err)
+	}
+	stats, err := rt.MemoryUsage()
+	if err != nil {
+		t.Fatalf("MemoryUsage() error = %v", err)
+	}
+	if stats.GCRuns != 1 {
+		t.Errorf("GCRuns = %d, want 1", stats.GCRuns)
+	}
+	if stats.GCTotalPause <= 0 || stats.GCLastPause <= 0 {
+		t.Errorf("GC pauses not recorded: %+v", stats)
+	}
+}
+
+// ============================================================================
+// Module Loader
+// ============================================================================
+
+func TestModuleLoader(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	loads := 0
+	err = rt.SetModuleLoader(func(specifier string) (string, error) {
+		if specifier != "math" {
+			return "", fmt.Errorf("unknown module %q", specifier)
+		}
+		loads++
+		return "export function double(x) { return x * 2; }", nil
+	})
+	if err != nil {
+		t.Fatalf("SetModuleLoader() error = %v", err)
+	}
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	script := `import { double } from "math"; globalThis.result = double(21);`
+	if _, err := ctx.EvalModule(script, "<main>"); err != nil {
+		t.Fatalf("EvalModule() error = %v", err)
+	}
+	result, err := ctx.Eval("result")
+	if err != nil {
+		t.Fatalf("Eval error = %v", err)
+	}
+	if result.String() != "42" {
+		t.Errorf("imported double(21) = %q, want %q", result.String(), "42")
+	}
+	if loads != 1 {
+		t.Errorf("loader called %d times, want 1", loads)
+	}
+
+	// A second context must hit the compiled-module cache, not the loader.
+	ctx2, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx2.Close()
+	if _, err := ctx2.EvalModule(script, "<main2>"); err != nil {
+		t.Fatalf("EvalModule() in second context error = %v", err)
+	}
+	if loads != 1 {
+		t.Errorf("loader called %d times after second context, want 1", loads)
+	}
+
+	if _, err := ctx.EvalModule(`import "missing";`, "<bad>"); err == nil {
+		t.Error("EvalModule() expected error for unresolvable import, got nil")
+	}
+}
+
+// ============================================================================
+// Fast Callbacks
+// ============================================================================
+
+func TestFastFunctionRoundTrip(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	var got []any
+	fn := ctx.FastFunction("probe", func(args []any) any {
+		got = args
+		return len(args)
+	})
+	if err := ctx.SetGlobal("probe", fn); err != nil {
+		t.Fatalf("SetGlobal() error = %v", err)
+	}
+
+	result, err := ctx.Eval(`probe(7, 1.5, "hi", true, null, [1, 2], {k: "v"})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	n, err := result.Int32()
+	if err != nil {
+		t.Fatalf("Int32() error = %v", err)
+	}
+	if n != 7 {
+		t.Errorf("probe(...) = %d, want 7", n)
+	}
+
+	want := []any{
+		int64(7), 1.5, "hi", true, nil,
+		[]any{int64(1), int64(2)},
+		map[string]any{"k": "v"},
+	}
+	if len(got) != len(want) {
+		t.Fatalf("callback received %d args, want %d", len(got), len(want))
+	}
+	for i := range want {
+		if fmt.Sprintf("%v", got[i]) != fmt.Sprintf("%v", want[i]) {
+			t.Errorf("arg %d = %#v, want %#v", i, got[i], want[i])
+		}
+	}
+}
+
+func TestFastFunctionReturnValues(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	fn := ctx.FastFunction("stats", func(args []any) any {
+		sum := 0.0
+		for _, a := range args {
+			switch v := a.(type) {
+			case int64:
+				sum += float64(v)
+			case float64:
+				sum += v
+			}
+		}
+		return map[string]any{"sum": sum, "count": len(args)}
+	})
+	if err := ctx.SetGlobal("stats", fn); err != nil {
+		t.Fatalf("SetGlobal() error = %v", err)
+	}
+
+	result, err := ctx.Eval(`JSON.stringify(stats(1, 2, 3.5))`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if got := result.String(); got != `{"sum":6.5,"count":3}` {
+		t.Errorf("stats(1, 2, 3.5) = %s, want %s", got, `{"sum":6.5,"count":3}`)
+	}
+
+	// nil result surfaces as undefined.
+	undef := ctx.FastFunction("nothing", func(args []any) any { return nil })
+	if err := ctx.SetGlobal("nothing", undef); err != nil {
+		t.Fatalf("SetGlobal() error = %v", err)
+	}
+	result, err = ctx.Eval(`nothing() === undefined`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if !result.Bool() {
+		t.Error("nothing() should evaluate to undefined")
+	}
+}
+
+// ============================================================================
+// GC Scheduling
+// ============================================================================
+
+func TestSetGCThreshold(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	if err := rt.SetGCThreshold(64 << 20); err != nil {
+		t.Fatalf("SetGCThreshold() error = %v", err)
+	}
+}
+
+func TestIdleGCCollectsWhenUncontended(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	if _, err := ctx.Eval(`for (let i = 0; i < 1000; i++) ({x: i});`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	rt.EnableIdleGC(time.Millisecond)
+	defer rt.DisableIdleGC()
+
+	deadline := time.Now().Add(2 * time.Second)
+	for time.Now().Before(deadline) {
+		stats, err := rt.MemoryUsage()
+		if err != nil {
+			t.Fatalf("MemoryUsage() error = %v", err)
+		}
+		if stats.GCRuns > 0 {
+			return
+		}
+		time.Sleep(5 * time.Millisecond)
+	}
+	t.Error("idle GC never ran within 2s")
+}
+
+func TestDisableIdleGCIdempotent(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	rt.DisableIdleGC() // never enabled: must be a no-op
+	rt.EnableIdleGC(time.Millisecond)
+	rt.EnableIdleGC(time.Millisecond) // second enable: no duplicate goroutine
+	rt.DisableIdleGC()
+	rt.DisableIdleGC()
+	// Close after enable must also shut the loop down cleanly.
+	rt.EnableIdleGC(time.Millisecond)
+}
+
+// ============================================================================
+// Streaming Eval
+// ============================================================================
+
+func TestEvalReader(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	result, err := ctx.EvalReader(strings.NewReader("6 * 7"), "<stream>")
+	if err != nil {
+		t.Fatalf("EvalReader() error = %v", err)
+	}
+	if result.String() != "42" {
+		t.Errorf("EvalReader(6 * 7) = %q, want %q", result.String(), "42")
+	}
+
+	if _, err := ctx.EvalReader(strings.NewReader("syntax error ((("), "<bad>"); err == nil {
+		t.Error("EvalReader() expected syntax error, got nil")
+	}
+
+	// The stream must be fully torn down after an error: the next
+	// evaluation starts fresh.
+	result, err = ctx.EvalReader(strings.NewReader("1 + 1"), "<stream2>")
+	if err != nil {
+		t.Fatalf("EvalReader() after error = %v", err)
+	}
+	if result.String() != "2" {
+		t.Errorf("EvalReader(1 + 1) = %q, want %q", result.String(), "2")
+	}
+}
+
+func TestEvalReaderLargerThanArena(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	// Build a script comfortably over the 4MB arena: a 6MB string literal.
+	var sb strings.Builder
+	sb.WriteString(`const s = "`)
+	chunk := strings.Repeat("a", 1024)
+	for i := 0; i < 6*1024; i++ {
+		sb.WriteString(chunk)
+	}
+	sb.WriteString(`"; s.length`)
+
+	result, err := ctx.EvalReader(strings.NewReader(sb.String()), "<big>")
+	if err != nil {
+		t.Fatalf("EvalReader() error = %v", err)
+	}
+	n, err := result.Int32()
+	if err != nil {
+		t.Fatalf("Int32() error = %v", err)
+	}
+	if want := int32(6 * 1024 * 1024); n != want {
+		t.Errorf("s.length = %d, want %d", n, want)
+	}
+
+	// The same script through Eval must now fail loudly instead of
+	// silently corrupting the arena.
+	if _, err := ctx.Eval(sb.String()); err == nil {
+		t.Error("Eval() of script larger than the arena expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Event Channel
+// ============================================================================
+
+func TestChannelPushDrain(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	reducer, err := ctx.Eval(`
+		globalThis.total = 0;
+		globalThis.batches = 0;
+		(events) => {
+			batches++;
+			for (const e of events) total += e.n;
+		}
+	`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	ch, err := ctx.NewChannel(reducer)
+	if err != nil {
+		t.Fatalf("NewChannel() error = %v", err)
+	}
+	defer ch.Close()
+
+	// Empty drain: no callback invocation.
+	n, err := ch.Drain()
+	if err != nil {
+		t.Fatalf("Drain() error = %v", err)
+	}
+	if n != 0 {
+		t.Errorf("Drain() on empty channel = %d, want 0", n)
+	}
+
+	type event struct {
+		N int `json:"n"`
+	}
+	for i := 1; i <= 100; i++ {
+		if err := ch.Push(event{N: i}); err != nil {
+			t.Fatalf("Push(%d) error = %v", i, err)
+		}
+	}
+	n, err = ch.Drain()
+	if err != nil {
+		t.Fatalf("Drain() error = %v", err)
+	}
+	if n != 100 {
+		t.Errorf("Drain() = %d events, want 100", n)
+	}
+
+	total, err := ctx.Eval("total")
+	if err != nil {
+		t.Fatalf("Eval(total) error = %v", err)
+	}
+	if got, _ := total.Int32(); got != 5050 {
+		t.Errorf("total = %d, want 5050", got)
+	}
+	batches, err := ctx.Eval("batches")
+	if err != nil {
+		t.Fatalf("Eval(batches) error = %v", err)
+	}
+	if got, _ := batches.Int32(); got != 1 {
+		t.Errorf("batches = %d, want 1 (one callback per drain)", got)
+	}
+}
+
+func TestChannelWrapAround(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	reducer, err := ctx.Eval(`
+		globalThis.seen = 0;
+		(events) => { seen += events.length; }
+	`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	ch, err := ctx.NewChannel(reducer)
+	if err != nil {
+		t.Fatalf("NewChannel() error = %v", err)
+	}
+	defer ch.Close()
+
+	// Push well over one ring capacity (1MB) in total so the producer
+	// wraps several times, draining between batches.
+	payload := strings.Repeat("x", 4096)
+	pushed := 0
+	for round := 0; round < 10; round++ {
+		for i := 0; i < 100; i++ {
+			if err := ch.Push(payload); err != nil {
+				t.Fatalf("Push() round %d event %d error = %v", round, i, err)
+			}
+			pushed++
+		}
+		if _, err := ch.Drain(); err != nil {
+			t.Fatalf("Drain() round %d error = %v", round, err)
+		}
+	}
+
+	seen, err := ctx.Eval("seen")
+	if err != nil {
+		t.Fatalf("Eval(seen) error = %v", err)
+	}
+	if got, _ := seen.Int32(); got != int32(pushed) {
+		t.Errorf("seen = %d, want %d", got, pushed)
+	}
+}
+
+func TestChannelFull(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	reducer, err := ctx.Eval("(events) => {}")
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	ch, err := ctx.NewChannel(reducer)
+	if err != nil {
+		t.Fatalf("NewChannel() error = %v", err)
+	}
+	defer ch.Close()
+
+	// Fill without draining until the ring rejects a push.
+	payload := strings.Repeat("y", 64*1024)
+	sawFull := false
+	for i := 0; i < 64; i++ {
+		if err := ch.Push(payload); err != nil {
+			if !errors.Is(err, ErrChannelFull) {
+				t.Fatalf("Push() error = %v, want ErrChannelFull", err)
+			}
+			sawFull = true
+			break
+		}
+	}
+	if !sawFull {
+		t.Fatal("Push() never returned ErrChannelFull on a full ring")
+	}
+
+	// Draining makes room again.
+	if _, err := ch.Drain(); err != nil {
+		t.Fatalf("Drain() error = %v", err)
+	}
+	if err := ch.Push(payload); err != nil {
+		t.Fatalf("Push() after Drain error = %v", err)
+	}
+}
+
+// ============================================================================
+// Sampling Profiler
+// ============================================================================
+
+func TestProfileHotFunction(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	if err := ctx.StartProfile(); err != nil {
+		t.Fatalf("StartProfile() error = %v", err)
+	}
+	// Enough opcodes to cross the interpreter's sampling interval many
+	// times, with the work concentrated in one named function.
+	_, err = ctx.Eval(`
+		function hotLoop() {
+			let sum = 0;
+			for (let i = 0; i < 2000000; i++) sum += i % 7;
+			return sum;
+		}
+		hotLoop();
+	`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	profile, err := ctx.StopProfile()
+	if err != nil {
+		t.Fatalf("StopProfile() error = %v", err)
+	}
+
+	if profile.Samples == 0 {
+		t.Fatal("profile recorded no samples")
+	}
+	var hot *ProfileEntry
+	for i := range profile.Functions {
+		if profile.Functions[i].Name == "hotLoop" {
+			hot = &profile.Functions[i]
+			break
+		}
+	}
+	if hot == nil {
+		t.Fatalf("hotLoop missing from profile: %+v", profile.Functions)
+	}
+	if hot.SelfSamples == 0 {
+		t.Error("hotLoop has no self samples")
+	}
+	if hot.TotalSamples < hot.SelfSamples {
+		t.Errorf("hotLoop total %d < self %d", hot.TotalSamples, hot.SelfSamples)
+	}
+}
+
+func TestProfileStartStopErrors(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	if _, err := ctx.StopProfile(); err == nil {
+		t.Error("StopProfile() without StartProfile expected error, got nil")
+	}
+	if err := ctx.StartProfile(); err != nil {
+		t.Fatalf("StartProfile() error = %v", err)
+	}
+	if err := ctx.StartProfile(); err == nil {
+		t.Error("second StartProfile() expected error, got nil")
+	}
+	if _, err := ctx.StopProfile(); err != nil {
+		t.Fatalf("StopProfile() error = %v", err)
+	}
+}
+
+// ============================================================================
+// Typed Arrays
+// ============================================================================
+
+func TestFloat64ArrayRoundTrip(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	in := []float64{1.5, -2.25, 3.75, 0, 1e300}
+	arr := ctx.Float64Array(in)
+	if err := ctx.SetGlobal("vec", arr); err != nil {
+		t.Fatalf("SetGlobal() error = %v", err)
+	}
+
+	result, err := ctx.Eval("vec instanceof Float64Array && vec.length === 5 && vec[1] === -2.25")
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if !result.Bool() {
+		t.Error("Float64Array not visible as expected from JS")
+	}
+
+	// Mutate in JS, read back in one bulk copy.
+	if _, err := ctx.Eval("vec[0] = 42.5"); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	out, err := arr.Float64s()
+	if err != nil {
+		t.Fatalf("Float64s() error = %v", err)
+	}
+	want := []float64{42.5, -2.25, 3.75, 0, 1e300}
+	if len(out) != len(want) {
+		t.Fatalf("Float64s() len = %d, want %d", len(out), len(want))
+	}
+	for i := range want {
+		if out[i] != want[i] {
+			t.Errorf("out[%d] = %v, want %v", i, out[i], want[i])
+		}
+	}
+}
+
+func TestInt32ArrayRoundTrip(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	in := make([]int32, 10000)
+	for i := range in {
+		in[i] = int32(i - 5000)
+	}
+	arr := ctx.Int32Array(in)
+	if err := ctx.SetGlobal("ints", arr); err != nil {
+		t.Fatalf("SetGlobal() error = %v", err)
+	}
+
+	sum, err := ctx.Eval("ints.reduce((a, b) => a + b, 0)")
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if got, _ := sum.Int32(); got != -5000 {
+		t.Errorf("sum = %d, want -5000", got)
+	}
+
+	out, err := arr.Int32s()
+	if err != nil {
+		t.Fatalf("Int32s() error = %v", err)
+	}
+	if len(out) != len(in) {
+		t.Fatalf("Int32s() len = %d, want %d", len(out), len(in))
+	}
+	for i := range in {
+		if out[i] != in[i] {
+			t.Fatalf("out[%d] = %d, want %d", i, out[i], in[i])
+		}
+	}
+}
+
+func TestTypedArrayTypeMismatch(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	arr := ctx.Int32Array([]int32{1, 2, 3})
+	if _, err := arr.Float64s(); err == nil {
+		t.Error("Float64s() on an Int32Array expected error, got nil")
+	}
+
+	notArr, err := ctx.Eval("({})")
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if _, err := notArr.Int32s(); err == nil {
+		t.Error("Int32s() on a plain object expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Regex Compilation Cache
+// ============================================================================
+
+func TestPrecompileRegex(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	patterns := []string{
+		`\d{4}-\d{2}-\d{2}`,
+		`ERROR|WARN|INFO`,
+		`^[a-z]+@[a-z]+\.[a-z]+$`,
+	}
+	if err := rt.PrecompileRegex(patterns); err != nil {
+		t.Fatalf("PrecompileRegex() error = %v", err)
+	}
+
+	// A fresh context using a warmed pattern must hit the cache.
+	_, missesBefore, err := rt.RegexCacheStats()
+	if err != nil {
+		t.Fatalf("RegexCacheStats() error = %v", err)
+	}
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+	result, err := ctx.Eval(`/\d{4}-\d{2}-\d{2}/.test("2026-08-27")`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if !result.Bool() {
+		t.Error("cached regex did not match")
+	}
+	hits, misses, err := rt.RegexCacheStats()
+	if err != nil {
+		t.Fatalf("RegexCacheStats() error = %v", err)
+	}
+	if hits == 0 {
+		t.Error("warmed pattern did not hit the regex cache")
+	}
+	if misses != missesBefore {
+		t.Errorf("warmed pattern missed the cache (misses %d -> %d)", missesBefore, misses)
+	}
+
+	if err := rt.PrecompileRegex([]string{"(unclosed"}); err == nil {
+		t.Error("PrecompileRegex() with invalid pattern expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Property Reflection
+// ============================================================================
+
+func TestValueKeys(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	obj, err := ctx.Eval(`({b: 1, a: 2, c: 3})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	keys, err := obj.Keys()
+	if err != nil {
+		t.Fatalf("Keys() error = %v", err)
+	}
+	// Own property order, not sorted.
+	want := []string{"b", "a", "c"}
+	if len(keys) != len(want) {
+		t.Fatalf("Keys() = %v, want %v", keys, want)
+	}
+	for i := range want {
+		if keys[i] != want[i] {
+			t.Errorf("Keys()[%d] = %q, want %q", i, keys[i], want[i])
+		}
+	}
+
+	num, err := ctx.Eval(`42`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if _, err := num.Keys(); err == nil {
+		t.Error("Keys() on a number expected error, got nil")
+	}
+}
+
+func TestValueEntries(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	obj, err := ctx.Eval(`({name: "widget", count: 7, nested: {ok: true}})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	entries, err := obj.Entries()
+	if err != nil {
+		t.Fatalf("Entries() error = %v", err)
+	}
+	if len(entries) != 3 {
+		t.Fatalf("Entries() returned %d entries, want 3", len(entries))
+	}
+	if entries[0].Key != "name" || entries[0].Value != "widget" {
+		t.Errorf("entries[0] = %+v, want {name widget}", entries[0])
+	}
+	if entries[1].Key != "count" || entries[1].Value != int64(7) {
+		t.Errorf("entries[1] = %+v, want {count 7}", entries[1])
+	}
+	nested, ok := entries[2].Value.(map[string]any)
+	if !ok || nested["ok"] != true {
+		t.Errorf("entries[2] = %+v, want nested {ok: true}", entries[2])
+	}
+}
+
+// ============================================================================
+// Workers
+// ============================================================================
+
+func TestWorkerEval(t *testing.T) {
+	w, err := NewWorker()
+	if err != nil {
+		t.Fatalf("NewWorker() error = %v", err)
+	}
+	defer w.Terminate()
+
+	if _, err := w.Eval(`let counter = 10`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	// State persists across jobs, unlike Executor.
+	result, err := w.Eval(`counter += 5`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if result != int64(15) {
+		t.Errorf("Eval() = %v, want 15", result)
+	}
+}
+
+func TestWorkerPostRoundTrip(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	w, err := NewWorker()
+	if err != nil {
+		t.Fatalf("NewWorker() error = %v", err)
+	}
+	defer w.Terminate()
+
+	if _, err := w.Eval(`onmessage = (msg) => postMessage({sum: msg.a + msg.b, tag: msg.tag})`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	got := make(chan map[string]any, 1)
+	err = w.OnMessage(ctx, func(v Value) {
+		var out map[string]any
+		if err := v.Unmarshal(&out); err != nil {
+			t.Errorf("Unmarshal() error = %v", err)
+		}
+		got <- out
+	})
+	if err != nil {
+		t.Fatalf("OnMessage() error = %v", err)
+	}
+
+	msg, err := ctx.Eval(`({a: 2, b: 3, tag: "job-1"})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if err := w.Post(msg); err != nil {
+		t.Fatalf("Post() error = %v", err)
+	}
+
+	select {
+	case out := <-got:
+		if out["sum"] != int64(5) || out["tag"] != "job-1" {
+			t.Errorf("worker reply = %v, want sum 5 tag job-1", out)
+		}
+	case <-time.After(2 * time.Second):
+		t.Fatal("no reply from worker within 2s")
+	}
+}
+
+func TestWorkerPostWithoutHandler(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	w, err := NewWorker()
+	if err != nil {
+		t.Fatalf("NewWorker() error = %v", err)
+	}
+	defer w.Terminate()
+
+	// No onmessage assigned: the message is dropped, not an error.
+	msg, err := ctx.Eval(`({x: 1})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if err := w.Post(msg); err != nil {
+		t.Errorf("Post() without handler error = %v, want nil", err)
+	}
+}
+
+func TestWorkerCloneRejectsFunctions(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	w, err := NewWorker()
+	if err != nil {
+		t.Fatalf("NewWorker() error = %v", err)
+	}
+	defer w.Terminate()
+
+	fn, err := ctx.Eval(`(() => 1)`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if err := w.Post(fn); err == nil {
+		t.Error("Post() with a function expected error, got nil")
+	}
+}
+
+func TestWorkerTerminateIdempotent(t *testing.T) {
+	w, err := NewWorker()
+	if err != nil {
+		t.Fatalf("NewWorker() error = %v", err)
+	}
+	w.Terminate()
+	w.Terminate()
+	if _, err := w.Eval(`1`); err == nil {
+		t.Error("Eval() after Terminate() expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Context Pooling
+// ============================================================================
+
+func TestContextReset(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	if _, err := ctx.Eval(`var leaked = {big: "state"}; globalThis.alsoLeaked = 1`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if err := ctx.Reset(); err != nil {
+		t.Fatalf("Reset() error = %v", err)
+	}
+
+	result, err := ctx.Eval(`typeof leaked + "/" + typeof alsoLeaked`)
+	if err != nil {
+		t.Fatalf("Eval() after Reset() error = %v", err)
+	}
+	if result.String() != "undefined/undefined" {
+		t.Errorf("globals after Reset() = %q, want undefined/undefined", result.String())
+	}
+
+	// Intrinsics and console survive the reset.
+	result, err = ctx.Eval(`typeof JSON.stringify + "/" + typeof console.log`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if result.String() != "function/function" {
+		t.Errorf("intrinsics after Reset() = %q, want function/function", result.String())
+	}
+}
+
+func TestContextPoolRecycles(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	pool, err := rt.NewContextPool(2)
+	if err != nil {
+		t.Fatalf("NewContextPool() error = %v", err)
+	}
+	defer pool.Close()
+
+	ctx, err := pool.Acquire()
+	if err != nil {
+		t.Fatalf("Acquire() error = %v", err)
+	}
+	if _, err := ctx.Eval(`var requestState = 42`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if err := pool.Release(ctx); err != nil {
+		t.Fatalf("Release() error = %v", err)
+	}
+
+	// Drain the pool: one of the two contexts is the recycled one, and it
+	// must not leak the previous request's globals.
+	for i := 0; i < 2; i++ {
+		ctx, err := pool.Acquire()
+		if err != nil {
+			t.Fatalf("Acquire() error = %v", err)
+		}
+		result, err := ctx.Eval(`typeof requestState`)
+		if err != nil {
+			t.Fatalf("Eval() error = %v", err)
+		}
+		if result.String() != "undefined" {
+			t.Errorf("recycled context leaked requestState (typeof = %q)", result.String())
+		}
+		if err := pool.Release(ctx); err != nil {
+			t.Fatalf("Release() error = %v", err)
+		}
+	}
+}
+
+func TestContextPoolClose(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	pool, err := rt.NewContextPool(1)
+	if err != nil {
+		t.Fatalf("NewContextPool() error = %v", err)
+	}
+	if err := pool.Close(); err != nil {
+		t.Fatalf("Close() error = %v", err)
+	}
+	if err := pool.Close(); err != nil {
+		t.Errorf("second Close() error = %v", err)
+	}
+	if _, err := pool.Acquire(); err == nil {
+		t.Error("Acquire() after Close() expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Event Loop
+// ============================================================================
+
+func TestServeFiresTimeout(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+	if err := ctx.EnableTimers(); err != nil {
+		t.Fatalf("EnableTimers() error = %v", err)
+	}
+
+	serveCtx, stop := context.WithCancel(context.Background())
+	defer stop()
+	go func() { _ = rt.Serve(serveCtx) }()
+
+	if _, err := ctx.Eval(`setTimeout(() => { globalThis.fired = true }, 10)`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	deadline := time.Now().Add(2 * time.Second)
+	for time.Now().Before(deadline) {
+		result, err := ctx.Eval(`globalThis.fired === true`)
+		if err != nil {
+			t.Fatalf("Eval() error = %v", err)
+		}
+		if result.Bool() {
+			return
+		}
+		time.Sleep(5 * time.Millisecond)
+	}
+	t.Error("setTimeout callback never fired within 2s")
+}
+
+func TestServeIntervalAndClear(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+	if err := ctx.EnableTimers(); err != nil {
+		t.Fatalf("EnableTimers() error = %v", err)
+	}
+
+	serveCtx, stop := context.WithCancel(context.Background())
+	defer stop()
+	go func() { _ = rt.Serve(serveCtx) }()
+
+	code := `globalThis.ticks = 0;
+globalThis.id = setInterval(() => {
+	ticks++;
+	if (ticks >= 3) clearInterval(id);
+}, 5)`
+	if _, err := ctx.Eval(code); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	deadline := time.Now().Add(2 * time.Second)
+	for time.Now().Before(deadline) {
+		result, err := ctx.Eval(`ticks`)
+		if err != nil {
+			t.Fatalf("Eval() error = %v", err)
+		}
+		n, err := result.Int32()
+		if err != nil {
+			t.Fatalf("Int32() error = %v", err)
+		}
+		if n >= 3 {
+			// Give the cleared interval a chance to misfire, then confirm
+			// it stopped.
+			time.Sleep(50 * time.Millisecond)
+			result, err = ctx.Eval(`ticks`)
+			if err != nil {
+				t.Fatalf("Eval() error = %v", err)
+			}
+			final, _ := result.Int32()
+			if final != 3 {
+				t.Errorf("interval fired %d times after clearInterval, want 3", final)
+			}
+			return
+		}
+		time.Sleep(5 * time.Millisecond)
+	}
+	t.Error("setInterval never reached 3 ticks within 2s")
+}
+
+func TestServeQueueMicrotask(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+	if err := ctx.EnableTimers(); err != nil {
+		t.Fatalf("EnableTimers() error = %v", err)
+	}
+
+	serveCtx, stop := context.WithCancel(context.Background())
+	defer stop()
+	go func() { _ = rt.Serve(serveCtx) }()
+
+	if _, err := ctx.Eval(`queueMicrotask(() => { globalThis.ran = true })`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	deadline := time.Now().Add(2 * time.Second)
+	for time.Now().Before(deadline) {
+		result, err := ctx.Eval(`globalThis.ran === true`)
+		if err != nil {
+			t.Fatalf("Eval() error = %v", err)
+		}
+		if result.Bool() {
+			return
+		}
+		time.Sleep(5 * time.Millisecond)
+	}
+	t.Error("queueMicrotask callback never ran within 2s")
+}
+
+func TestTimersWithoutServe(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+	if err := ctx.EnableTimers(); err != nil {
+		t.Fatalf("EnableTimers() error = %v", err)
+	}
+
+	// No Serve loop: scheduling must fail loudly instead of leaking a
+	// callback that never fires.
+	if _, err := ctx.Eval(`setTimeout(() => {}, 10)`); err == nil {
+		t.Error("setTimeout without Serve expected error, got nil")
+	}
+}
+
+// ============================================================================
+// Memory Watermark
+// ============================================================================
+
+func TestMemoryWatermarkFires(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	// The callback runs synchronously on the goroutine executing JS, so no
+	// synchronization is needed to observe it after Eval returns.
+	var fired int
+	var seen MemoryStats
+	if err := rt.SetMemoryWatermark(1<<20, func(stats MemoryStats) {
+		fired++
+		seen = stats
+	}); err != nil {
+		t.Fatalf("SetMemoryWatermark() error = %v", err)
+	}
+
+	heavy := `let a = []; for (let i = 0; i < 50000; i++) a.push("x".repeat(100) + i); a.length`
+	if _, err := ctx.Eval(heavy); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if fired != 1 {
+		t.Fatalf("watermark fired %d times, want 1", fired)
+	}
+	if seen.MallocSize < 1<<20 {
+		t.Errorf("callback saw MallocSize = %d, want >= %d", seen.MallocSize, 1<<20)
+	}
+
+	// One-shot: a second heavy eval without re-arming must not fire again.
+	if _, err := ctx.Eval(heavy); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if fired != 1 {
+		t.Errorf("watermark fired %d times without re-arm, want 1", fired)
+	}
+}
+
+func TestMemoryWatermarkDisarm(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	fired := false
+	if err := rt.SetMemoryWatermark(1<<20, func(MemoryStats) { fired = true }); err != nil {
+		t.Fatalf("SetMemoryWatermark() error = %v", err)
+	}
+	if err := rt.SetMemoryWatermark(0, nil); err != nil {
+		t.Fatalf("SetMemoryWatermark(0) error = %v", err)
+	}
+
+	if _, err := ctx.Eval(`let a = []; for (let i = 0; i < 50000; i++) a.push("x".repeat(100) + i); a.length`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if fired {
+		t.Error("disarmed watermark still fired")
+	}
+}
+
+// ============================================================================
+// Bound Methods
+// ============================================================================
+
+func TestBindCall(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	obj, err := ctx.Eval(`({total: 0, add(n) { this.total += n; return this.total; }})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	add, err := obj.Bind("add")
+	if err != nil {
+		t.Fatalf("Bind() error = %v", err)
+	}
+	defer add.Release()
+
+	var last int32
+	for i := int32(1); i <= 3; i++ {
+		result, err := add.Call(ctx.Int32(i))
+		if err != nil {
+			t.Fatalf("Call() error = %v", err)
+		}
+		last, err = result.Int32()
+		if err != nil {
+			t.Fatalf("Int32() error = %v", err)
+		}
+	}
+	// 1+2+3 accumulated on the pinned receiver.
+	if last != 6 {
+		t.Errorf("bound add calls accumulated to %d, want 6", last)
+	}
+}
+
+func TestBindErrors(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	obj, err := ctx.Eval(`({n: 1})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	if _, err := obj.Bind("n"); err == nil {
+		t.Error("Bind() on a non-function property expected error, got nil")
+	}
+	if _, err := obj.Bind("missing"); err == nil {
+		t.Error("Bind() on a missing property expected error, got nil")
+	}
+
+	thrower, err := obj.Bind("hasOwnProperty")
+	if err != nil {
+		t.Fatalf("Bind(hasOwnProperty) error = %v", err)
+	}
+	defer thrower.Release()
+	result, err := thrower.Call(ctx.String("n"))
+	if err != nil {
+		t.Fatalf("Call() error = %v", err)
+	}
+	if !result.Bool() {
+		t.Error("bound hasOwnProperty('n') = false, want true")
+	}
+}
+
+// ============================================================================
+// Bridge Tracing
+// ============================================================================
+
+func TestTraceStats(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	rt.EnableTracing()
+	defer rt.DisableTracing()
+	if _, err := ctx.Eval(`1 + 1`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	stats, err := rt.TraceStats()
+	if err != nil {
+		t.Fatalf("TraceStats() error = %v", err)
+	}
+	if len(stats.Funcs) == 0 {
+		t.Fatal("TraceStats() returned no function entries after a traced Eval")
+	}
+	seenEval := false
+	for _, ft := range stats.Funcs {
+		if ft.Calls == 0 {
+			t.Errorf("trace entry %q has zero calls", ft.Name)
+		}
+		var bucketed uint64
+		for _, n := range ft.Buckets {
+			bucketed += n
+		}
+		if bucketed != ft.Calls {
+			t.Errorf("trace entry %q buckets sum to %d, want %d", ft.Name, bucketed, ft.Calls)
+		}
+		if ft.Name == "qjs_eval" {
+			seenEval = true
+		}
+	}
+	if !seenEval {
+		t.Error("TraceStats() has no qjs_eval entry")
+	}
+	if stats.SlotsAllocated == 0 {
+		t.Error("TraceStats() reports zero slots allocated")
+	}
+	if stats.ArenaCap == 0 {
+		t.Error("TraceStats() reports zero arena capacity")
+	}
+}
+
+func TestTracingDisabledByDefault(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	if _, err := ctx.Eval(`1 + 1`); err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+	stats, err := rt.TraceStats()
+	if err != nil {
+		t.Fatalf("TraceStats() error = %v", err)
+	}
+	if len(stats.Funcs) != 0 {
+		t.Errorf("TraceStats() recorded %d entries with tracing disabled, want 0", len(stats.Funcs))
+	}
+}
+
+// ============================================================================
+// Primitive Fast Path
+// ============================================================================
+
+func TestEvalPrimitive(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	tests := []struct {
+		code string
+		want any
+	}{
+		{`1 + 1`, int64(2)},
+		{`1.5 * 2`, float64(3)},
+		{`2 > 1`, true},
+		{`null`, nil},
+		{`undefined`, nil},
+	}
+	for _, tt := range tests {
+		got, err := ctx.EvalPrimitive(tt.code)
+		if err != nil {
+			t.Fatalf("EvalPrimitive(%q) error = %v", tt.code, err)
+		}
+		if got != tt.want {
+			t.Errorf("EvalPrimitive(%q) = %v (%T), want %v (%T)", tt.code, got, got, tt.want, tt.want)
+		}
+	}
+}
+
+func TestEvalPrimitiveFallback(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	got, err := ctx.EvalPrimitive(`({answer: 42})`)
+	if err != nil {
+		t.Fatalf("EvalPrimitive() error = %v", err)
+	}
+	obj, ok := got.(Value)
+	if !ok {
+		t.Fatalf("EvalPrimitive(object) = %T, want Value", got)
+	}
+	answer, err := obj.Get("answer")
+	if err != nil {
+		t.Fatalf("Get() error = %v", err)
+	}
+	if n, err := answer.Int32(); err != nil || n != 42 {
+		t.Errorf("answer = %v, %v, want 42", n, err)
+	}
+
+	if _, err := ctx.EvalPrimitive(`throw new Error("prim boom")`); err == nil {
+		t.Error("EvalPrimitive(throw) expected error, got nil")
+	} else if !strings.Contains(err.Error(), "prim boom") {
+		t.Errorf("EvalPrimitive(throw) error = %v, want it to contain the thrown message", err)
+	}
+}
+
+func TestCallPrimitive(t *testing.T) {
+	rt, err := NewRuntime()
+	if err != nil {
+		t.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+	ctx, err := rt.NewContext()
+	if err != nil {
+		t.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	rules, err := ctx.Eval(`({
+		allow: function(n) { return n < 10; },
+		score: function(n) { return n * 2; }
+	})`)
+	if err != nil {
+		t.Fatalf("Eval() error = %v", err)
+	}
+
+	allow, err := rules.Bind("allow")
+	if err != nil {
+		t.Fatalf("Bind(allow) error = %v", err)
+	}
+	defer allow.Release()
+	got, err := allow.CallPrimitive(ctx.Int32(5))
+	if err != nil {
+		t.Fatalf("CallPrimitive() error = %v", err)
+	}
+	if got != true {
+		t.Errorf("allow(5) = %v, want true", got)
+	}
+
+	fn, err := rules.Get("score")
+	if err != nil {
+		t.Fatalf("Get(score) error = %v", err)
+	}
+	got, err = fn.CallPrimitive(rules, ctx.Int32(21))
+	if err != nil {
+		t.Fatalf("CallPrimitive() error = %v", err)
+	}
+	if got != int64(42) {
+		t.Errorf("score(21) = %v (%T), want 42", got, got)
+	}
+}
+
 // ============================================================================
 // Benchmarks
 // ============================================================================
@@ -2276,6 +4758,30 @@ func BenchmarkEvalReuse(b *testing.B) {
 	}
 }
 
+// BenchmarkEvalPrimitive is BenchmarkEvalReuse on the slot-free fast path
+func BenchmarkEvalPrimitive(b *testing.B) {
+	rt, err := NewRuntime()
+	if err != nil {
+		b.Fatalf("NewRuntime() error = %v", err)
+	}
+	defer rt.Close()
+
+	ctx, err := rt.NewContext()
+	if err != nil {
+		b.Fatalf("NewContext() error = %v", err)
+	}
+	defer ctx.Close()
+
+	b.ResetTimer()
+	for b.Loop() {
+		result, err := ctx.EvalPrimitive("1 + 2")
+		if err != nil {
+			b.Fatalf("EvalPrimitive error = %v", err)
+		}
+		_ = result
+	}
+}
+
 // BenchmarkEvalFibonacci benchmarks Fibonacci calculation with reuse
 func BenchmarkEvalFibonacci(b *testing.B) {
 	rt, err := NewRuntime()
@@ -0,0 +1,99 @@
+package quickjs
+
+import (
+	"context"
+	"encoding/binary"
+	"errors"
+	"fmt"
+
+	"github.com/Gaurav-Gosain/quickjs/internal/bridge"
+)
+
+// snapshotMagic identifies a runtime snapshot blob (and its format version).
+const snapshotMagic = "QJSSNAP1"
+
+// Snapshot captures the state of the runtime — the entire WASM linear
+// memory, which contains the QuickJS heap, the JSValue slot table and the
+// arena — plus the handles of the given contexts, into a blob that
+// NewRuntimeFromSnapshot can restore. Typical use is to run expensive
+// initialization (vendor bundles, intrinsic warm-up) once, snapshot, and
+// then restore per request for V8-isolate-snapshot-style cold starts.
+//
+// The snapshot must be taken while no evaluation is in progress. Go
+// functions registered with Context.Function are not captured; they must be
+// re-registered on the restored runtime before the restored code calls them.
+func (r *Runtime) Snapshot(contexts ...*Context) ([]byte, error) {
+	r.lock()
+	defer r.unlock()
+
+	mem, err := r.bridge.SnapshotMemory()
+	if err != nil {
+		return nil, fmt.Errorf("failed to snapshot WASM memory: %w", err)
+	}
+
+	blob := make([]byte, 0, len(snapshotMagic)+12+len(contexts)*4+len(mem))
+	blob = append(blob, snapshotMagic...)
+	blob = binary.LittleEndian.AppendUint32(blob, r.rtPtr)
+	blob = binary.LittleEndian.AppendUint32(blob, uint32(len(contexts)))
+	for _, c := range contexts {
+		blob = binary.LittleEndian.AppendUint32(blob, c.ctxPtr)
+	}
+	blob = binary.LittleEndian.AppendUint32(blob, uint32(len(mem)))
+	blob = append(blob, mem...)
+	return blob, nil
+}
+
+// NewRuntimeFromSnapshot creates a runtime from a snapshot taken with
+// Runtime.Snapshot, restoring the captured contexts alongside it. The WASM
+// module is freshly instantiated (cheap, thanks to the compilation cache)
+// and its linear memory overwritten with the captured image, so the restored
+// runtime resumes with all initialization work already done.
+func NewRuntimeFromSnapshot(blob []byte) (*Runtime, []*Context, error) {
+	return NewRuntimeFromSnapshotWithContext(context.Background(), blob)
+}
+
+// NewRuntimeFromSnapshotWithContext is NewRuntimeFromSnapshot with the given
+// context used for all WASM operations.
+func NewRuntimeFromSnapshotWithContext(ctx context.Context, blob []byte) (*Runtime, []*Context, error) {
+	if len(blob) < len(snapshotMagic)+12 || string(blob[:len(snapshotMagic)]) != snapshotMagic {
+		return nil, nil, errors.New("invalid runtime snapshot")
+	}
+	off := len(snapshotMagic)
+	rtPtr := binary.LittleEndian.Uint32(blob[off:])
+	numCtx := binary.LittleEndian.Uint32(blob[off+4:])
+	off += 8
+	if len(blob) < off+int(numCtx)*4+4 {
+		return nil, nil, errors.New("truncated runtime snapshot")
+	}
+	ctxPtrs := make([]uint32, numCtx)
+	for i := range ctxPtrs {
+		ctxPtrs[i] = binary.LittleEndian.Uint32(blob[off:])
+		off += 4
+	}
+	memLen := binary.LittleEndian.Uint32(blob[off:])
+	off += 4
+	if len(blob) != off+int(memLen) {
+		return nil, nil, errors.New("truncated runtime snapshot")
+	}
+
+	b, err := bridge.New(ctx)
+	if err != nil {
+		return nil, nil, fmt.Errorf("failed to initialize QuickJS bridge: %w", err)
+	}
+	if err := b.RestoreMemory(blob[off:]); err != nil {
+		_ = b.Close(ctx)
+		return nil, nil, fmt.Errorf("failed to restore snapshot: %w", err)
+	}
+
+	rt := &Runtime{
+		bridge:  b,
+		rtPtr:   rtPtr,
+		goCtx:   ctx,
+		logFunc: func(msg string) { fmt.Print(msg) },
+	}
+	contexts := make([]*Context, numCtx)
+	for i, ctxPtr := range ctxPtrs {
+		contexts[i] = &Context{runtime: rt, ctxPtr: ctxPtr, atoms: make(map[string]uint32)}
+	}
+	return rt, contexts, nil
+}
@@ -0,0 +1,97 @@
+package quickjs
+
+import (
+	"time"
+
+	"github.com/Gaurav-Gosain/quickjs/internal/bridge"
+)
+
+// Bridge tracing instruments every Go/WASM boundary crossing with a
+// nanosecond timer feeding a per-export latency histogram, alongside slot
+// table and arena counters from the module itself. It answers "where did
+// the time go" questions — call overhead vs engine execution vs memory
+// traffic — without an external profiler. Disabled (the default) it costs
+// one atomic load per crossing.
+
+// TraceBucketCount is the number of histogram buckets per export; the
+// last bucket counts calls above the largest bound.
+const TraceBucketCount = bridge.TraceBucketCount
+
+// TraceBucketBounds returns the inclusive upper bounds of the first
+// TraceBucketCount-1 histogram buckets, for labeling exported metrics.
+func TraceBucketBounds() [TraceBucketCount - 1]time.Duration {
+	var bounds [TraceBucketCount - 1]time.Duration
+	for i, b := range bridge.TraceBucketBounds {
+		bounds[i] = time.Duration(b)
+	}
+	return bounds
+}
+
+// FuncTrace is the accumulated call statistics for one WASM export.
+type FuncTrace struct {
+	Name    string                   // export name, e.g. "qjs_eval"
+	Calls   uint64                   // total calls while tracing was enabled
+	Total   time.Duration            // total wall time across those calls
+	Buckets [TraceBucketCount]uint64 // latency histogram (see TraceBucketBounds)
+}
+
+// TraceStats is a snapshot of bridge instrumentation: per-export latency
+// histograms plus slot-table and arena counters.
+type TraceStats struct {
+	// Funcs holds one entry per export called at least once while tracing
+	// was enabled, busiest (by total time) first.
+	Funcs []FuncTrace
+
+	// Slot table occupancy: handles currently live, slots allocated, and
+	// uses of stale handles observed since the runtime started.
+	SlotsInUse      uint32
+	SlotsAllocated  uint32
+	StaleHandleUses uint32
+
+	// Bump arena usage: bytes currently in use, capacity, and how many
+	// times the arena has been reset.
+	ArenaUsed   uint32
+	ArenaCap    uint32
+	ArenaResets uint64
+}
+
+// EnableTracing starts recording per-export latency histograms. Counters
+// accumulate across enable/disable cycles; tracing is off by default.
+func (r *Runtime) EnableTracing() {
+	r.bridge.EnableTracing()
+}
+
+// DisableTracing stops recording. Already-accumulated counters remain
+// readable through TraceStats.
+func (r *Runtime) DisableTracing() {
+	r.bridge.DisableTracing()
+}
+
+// TraceStats returns a snapshot of the bridge instrumentation. The
+// histograms are meaningful only after EnableTracing; the slot and arena
+// counters are always live.
+func (r *Runtime) TraceStats() (TraceStats, error) {
+	r.lock()
+	defer r.unlock()
+
+	var stats TraceStats
+	for _, ft := range r.bridge.TraceSnapshot() {
+		stats.Funcs = append(stats.Funcs, FuncTrace{
+			Name:    ft.Name,
+			Calls:   ft.Calls,
+			Total:   time.Duration(ft.TotalNanos),
+			Buckets: ft.Buckets,
+		})
+	}
+
+	var err error
+	stats.SlotsInUse, stats.SlotsAllocated, stats.StaleHandleUses, err = r.bridge.SlotStats(r.goCtx)
+	if err != nil {
+		return TraceStats{}, err
+	}
+	stats.ArenaUsed, stats.ArenaCap, stats.ArenaResets, err = r.bridge.ArenaStats(r.goCtx)
+	if err != nil {
+		return TraceStats{}, err
+	}
+	return stats, nil
+}
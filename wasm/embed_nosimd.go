@@ -0,0 +1,7 @@
+//go:build !quickjs_simd
+
+package wasm
+
+// QuickJSSIMD is empty without the quickjs_simd build tag; the bridge
+// then always instantiates the scalar QuickJS binary.
+var QuickJSSIMD []byte
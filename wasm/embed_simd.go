@@ -0,0 +1,13 @@
+//go:build quickjs_simd
+
+package wasm
+
+import _ "embed"
+
+// QuickJSSIMD is the SIMD-enabled QuickJS-ng WebAssembly binary, built
+// with `make simd` in csrc (requires the -msimd128 output to exist before
+// building with this tag). The bridge prefers it when the host supports
+// the WASM SIMD proposal and falls back to the scalar QuickJS binary.
+//
+//go:embed quickjs-simd.wasm
+var QuickJSSIMD []byte
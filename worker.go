@@ -0,0 +1,245 @@
+package quickjs
+
+import (
+	"errors"
+	"fmt"
+	"sync"
+)
+
+// Worker is a second runtime on its own goroutine with postMessage-style
+// transfer to and from the host. Unlike Executor's anonymous pool, a Worker
+// keeps state between jobs, so it suits long-lived background computation
+// that the main context feeds incrementally. Values cross between runtimes
+// as a binary structured clone (the engine's object serializer, the same
+// machinery behind bytecode caching), so megabyte payloads with nested
+// objects, typed arrays and ArrayBuffers move at memcpy speed instead of
+// being stringified to JSON and re-parsed on the other side.
+//
+// Inside the worker, scripts receive host messages by assigning a global
+// `onmessage` function and send messages back with the global
+// `postMessage(value)`.
+//
+// Usage:
+//
+//	w, err := quickjs.NewWorker()
+//	...
+//	w.Eval(`onmessage = (msg) => postMessage(msg.x * 2)`)
+//	w.OnMessage(mainCtx, func(v quickjs.Value) { ... })
+//	w.Post(someValue)
+type Worker struct {
+	rt  *Runtime
+	ctx *Context
+
+	jobs chan workerJob
+	out  chan []byte
+	wg   sync.WaitGroup
+
+	mu          sync.Mutex
+	closed      bool
+	dispatching bool
+}
+
+type workerJob struct {
+	fn   func(*Context) error
+	done chan error
+}
+
+// workerOutboxCap bounds messages buffered between the worker's postMessage
+// and the host's OnMessage dispatcher. When the buffer is full, postMessage
+// throws in the worker script rather than blocking the engine.
+const workerOutboxCap = 64
+
+// NewWorker creates a worker with its own runtime and context and starts
+// its goroutine.
+func NewWorker() (*Worker, error) {
+	rt, err := NewRuntime()
+	if err != nil {
+		return nil, fmt.Errorf("failed to start worker: %w", err)
+	}
+	ctx, err := rt.NewContext()
+	if err != nil {
+		rt.Close()
+		return nil, fmt.Errorf("failed to start worker: %w", err)
+	}
+
+	w := &Worker{
+		rt:   rt,
+		ctx:  ctx,
+		jobs: make(chan workerJob),
+		out:  make(chan []byte, workerOutboxCap),
+	}
+
+	// postMessage clones its argument out of the worker while the callback
+	// holds the worker's mutex, then hands the bytes to the dispatcher; the
+	// worker never touches the receiving runtime.
+	post := ctx.Function("postMessage", func(c *Context, this Value, args []Value) Value {
+		if len(args) == 0 {
+			return c.ThrowTypeError("postMessage requires an argument")
+		}
+		data, err := c.runtime.bridge.CloneWrite(c.runtime.goCtx, c.ctxPtr, args[0].ptr)
+		if err != nil {
+			return c.ThrowError(err.Error())
+		}
+		if data == nil {
+			// Serialization failed (e.g. a function in the payload);
+			// re-throw the pending exception so the script sees it.
+			return c.ThrowError(c.pendingError().Error())
+		}
+		select {
+		case w.out <- data:
+			return c.undefinedUnlocked()
+		default:
+			return c.ThrowError("worker message queue is full")
+		}
+	})
+	if err := ctx.SetGlobal("postMessage", post); err != nil {
+		ctx.Close()
+		rt.Close()
+		return nil, fmt.Errorf("failed to start worker: %w", err)
+	}
+
+	w.wg.Add(1)
+	go w.loop()
+	return w, nil
+}
+
+func (w *Worker) loop() {
+	defer w.wg.Done()
+	for job := range w.jobs {
+		job.done <- job.fn(w.ctx)
+	}
+	// No script can run past this point, so no more postMessage sends.
+	close(w.out)
+	w.ctx.Close()
+	w.rt.Close()
+}
+
+// Do runs fn on the worker's context and blocks until it returns. The
+// context (and any Value derived from it) lives on the worker and must not
+// escape fn.
+func (w *Worker) Do(fn func(*Context) error) error {
+	job := workerJob{fn: fn, done: make(chan error, 1)}
+
+	w.mu.Lock()
+	if w.closed {
+		w.mu.Unlock()
+		return errors.New("worker is terminated")
+	}
+	w.jobs <- job
+	w.mu.Unlock()
+
+	return <-job.done
+}
+
+// Eval runs code on the worker and returns the result decoded into Go
+// (bool, int64, float64, string, []any, map[string]any or nil).
+func (w *Worker) Eval(code string) (any, error) {
+	var out any
+	err := w.Do(func(ctx *Context) error {
+		val, err := ctx.Eval(code)
+		if err != nil {
+			return err
+		}
+		return val.Unmarshal(&out)
+	})
+	return out, err
+}
+
+// Post structured-clones v out of its home runtime and delivers it to the
+// worker's global onmessage function, blocking until the handler returns.
+// Posting when no onmessage is assigned silently drops the message, like a
+// browser worker.
+func (w *Worker) Post(v Value) error {
+	if v.ctx == nil {
+		return errors.New("nil value")
+	}
+
+	v.ctx.runtime.lock()
+	data, err := v.ctx.runtime.bridge.CloneWrite(v.ctx.runtime.goCtx, v.ctx.ctxPtr, v.ptr)
+	if err == nil && data == nil {
+		err = v.ctx.pendingError()
+	}
+	v.ctx.runtime.unlock()
+	if err != nil {
+		return fmt.Errorf("failed to clone message: %w", err)
+	}
+
+	return w.Do(func(ctx *Context) error {
+		return deliverClone(ctx, data, "onmessage")
+	})
+}
+
+// deliverClone materializes a structured-clone buffer in ctx and, if a
+// global function with the given name is assigned, calls it with the value.
+func deliverClone(ctx *Context, data []byte, handlerName string) error {
+	ctx.runtime.lock()
+	valPtr, err := ctx.runtime.bridge.CloneRead(ctx.runtime.goCtx, ctx.ctxPtr, data)
+	var val Value
+	if err == nil {
+		val, err = ctx.checkException(valPtr)
+	}
+	ctx.runtime.unlock()
+	if err != nil {
+		return fmt.Errorf("failed to read message: %w", err)
+	}
+
+	handler, err := ctx.GetGlobal(handlerName)
+	if err != nil {
+		return err
+	}
+	if !handler.IsFunction() {
+		return nil
+	}
+	_, err = handler.Call(ctx.Undefined(), val)
+	return err
+}
+
+// OnMessage starts delivering the worker's postMessage calls to fn, with
+// each message materialized in target's runtime. Dispatch runs on its own
+// goroutine, so fn may itself Post back to the worker. Only one handler may
+// be installed per worker.
+func (w *Worker) OnMessage(target *Context, fn func(Value)) error {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+	if w.closed {
+		return errors.New("worker is terminated")
+	}
+	if w.dispatching {
+		return errors.New("worker already has a message handler")
+	}
+	w.dispatching = true
+
+	w.wg.Add(1)
+	go func() {
+		defer w.wg.Done()
+		for data := range w.out {
+			target.runtime.lock()
+			valPtr, err := target.runtime.bridge.CloneRead(target.runtime.goCtx, target.ctxPtr, data)
+			var val Value
+			if err == nil {
+				val, err = target.checkException(valPtr)
+			}
+			target.runtime.unlock()
+			if err != nil {
+				continue
+			}
+			fn(val)
+		}
+	}()
+	return nil
+}
+
+// Terminate shuts down the worker and its runtime, waiting for the
+// in-flight job and any undelivered messages to finish.
+func (w *Worker) Terminate() {
+	w.mu.Lock()
+	if w.closed {
+		w.mu.Unlock()
+		return
+	}
+	w.closed = true
+	close(w.jobs)
+	w.mu.Unlock()
+
+	w.wg.Wait()
+}